@@ -1,11 +1,17 @@
 #pragma once
 
+#include <atomic>
+#include <concepts>
 #include <cstring>
 #include <functional>
 #include <initializer_list>
 #include <memory>
+#include <memory_resource>
 #include <sstream>
+#include <utility>
+#include <vector>
 
+#include "Statistics.hpp"
 #include "detail/utility.hpp"
 
 namespace chunked_list {
@@ -15,6 +21,42 @@ namespace chunked_list {
   template<typename, bool>
   class ChunkedListSlice;
 
+  template<typename, bool>
+  class ChunkView;
+
+  template<typename, size_t>
+  class MappedChunkedList;
+
+  /**
+   * @brief Opts a chunked list type into keeping a zone map of each chunk, bounding its elements by the smallest and
+   * largest of them, by specializing it to true before the type is first used. Filtered scans skip the chunks whose
+   * zone map lies outside their range
+   * @tparam ChunkedListType The type of chunked list, whose elements must be totally ordered, copyable and default
+   * constructible, as each zone map holds a pair of them even while its chunk is empty
+   */
+  template<typename ChunkedListType>
+  inline constexpr bool enable_zone_maps = false;
+
+  /**
+   * @brief Opts a chunked list type into keeping fences for its sorted searches, a compact array of the first element
+   * of each chunk, by specializing it to true before the type is first used. Lists without them search by walking
+   * their chunks, and spend no memory on them
+   * @tparam ChunkedListType The type of chunked list, whose elements must be copyable
+   */
+  template<typename ChunkedListType>
+  inline constexpr bool enable_fences = false;
+
+  /**
+   * @brief Opts a chunked list type into splitting bulk construction, copying, filling, resizing and comparison
+   * between threads once the elements involved take up at least utility::parallel_threshold bytes, by specializing it
+   * to true before the type is first used. Each such operation starts and joins its own threads, so lists without it
+   * stay on the calling thread
+   * @tparam ChunkedListType The type of chunked list, whose elements must be safe to construct, assign and compare
+   * from several threads at once
+   */
+  template<typename ChunkedListType>
+  inline constexpr bool enable_parallelism = false;
+
   /**
    * @class ChunkedList
    * @brief A contiguous-like linear data structure, implemented as a linked list of fixed-size chunks.
@@ -36,15 +78,39 @@ namespace chunked_list {
       template<typename, bool>
       friend class ChunkedListSlice;
 
+      template<typename, bool>
+      friend class ChunkView;
+
+      template<typename, size_t>
+      friend class MappedChunkedList;
+
       template<bool>
       class generic_iterator;
 
-      size_t chunk_count;
+      size_t chunk_count{0};
+
+      size_t element_count{0};
 
       using ValueAllocator = Allocator<T>;
 
       using ValueAllocatorTraits = std::allocator_traits<ValueAllocator>;
 
+      /**
+       * @brief The smallest and largest elements of a chunk, kept for chunked lists opted in with enable_zone_maps
+       */
+      struct ZoneMap {
+          T minimum{};
+          T maximum{};
+
+          /**
+           * @brief Whether every element of the chunk lies within [minimum, maximum]. Handing out a mutable reference
+           * to an element ends this until the zone map is rebuilt, while removing elements keeps the bounds valid
+           */
+          bool current{false};
+      };
+
+      struct NoZoneMap {};
+
     public:
       /**
        * @brief The non-const iterator class used to iterate through each value of every chunk in the chunked list
@@ -60,6 +126,8 @@ namespace chunked_list {
       using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
       class Chunk {
+          friend class ChunkedList;
+
           ValueAllocator value_allocator;
 
           size_t nextIndex{0};
@@ -69,14 +137,48 @@ namespace chunked_list {
           Chunk *nextChunk{nullptr};
 
         private:
+          static constexpr bool zoned = enable_zone_maps<ChunkedList>;
+
+          [[no_unique_address]] std::conditional_t<zoned, ZoneMap, NoZoneMap> zone{};
+
           alignas(T) std::byte array[ChunkSize][sizeof(T)]{};
 
+          /**
+           * @return The elements of the chunk, without ending its zone map as the mutable data does
+           */
+          T *raw_data();
+
+          /**
+           * @brief Widens the zone map to bound an element about to be added to the back of the chunk
+           */
+          void widen_zone(const T &value);
+
+          void invalidate_zone();
+
+          /**
+           * @brief Recomputes the zone map from every element of the chunk
+           */
+          void rebuild_zone();
+
+          /**
+           * @return Whether the zone map proves that no element of the chunk lies within [low, high]
+           */
+          bool outside_zone(const T &low, const T &high) const;
+
+          /**
+           * @return Whether the zone map proves that every element of the chunk lies within [low, high]
+           */
+          bool within_zone(const T &low, const T &high) const;
+
         public:
-          explicit Chunk(Chunk *prevChunk, Chunk *nextChunk = nullptr);
+          explicit Chunk(Chunk *prevChunk, Chunk *nextChunk = nullptr,
+                         const ValueAllocator &valueAllocator = ValueAllocator{});
 
-          Chunk(const T *pointer, size_t size, Chunk *prevChunk = nullptr, Chunk *nextChunk = nullptr);
+          Chunk(const T *pointer, size_t size, Chunk *prevChunk = nullptr, Chunk *nextChunk = nullptr,
+                const ValueAllocator &valueAllocator = ValueAllocator{});
 
-          explicit Chunk(T &&value, Chunk *prevChunk = nullptr, Chunk *nextChunk = nullptr);
+          explicit Chunk(T &&value, Chunk *prevChunk = nullptr, Chunk *nextChunk = nullptr,
+                         const ValueAllocator &valueAllocator = ValueAllocator{});
 
           Chunk() = default;
 
@@ -107,6 +209,12 @@ namespace chunked_list {
 
           void pop_back();
 
+          /**
+           * @brief Destroys every element from the given index onwards at once
+           * @param count The number of elements left in the chunk, which must not exceed its size
+           */
+          void truncate(size_t count);
+
           void clear();
 
           /**
@@ -176,6 +284,161 @@ namespace chunked_list {
 
       constexpr const Chunk *get_sentinel() const;
 
+      /**
+       * @brief The fences of a chunked list opted in with enable_fences, allocated when they are first built
+       */
+      struct Fences {
+          /**
+           * @brief The first element of every non-empty chunk in order, kept apart from the chunks so binary
+           * searching them touches as few cache lines as possible
+           */
+          std::vector<T> keys;
+
+          /**
+           * @brief The chunk each fence key is the first element of
+           */
+          std::vector<const Chunk *> chunks;
+
+          /**
+           * @brief Whether the fences were built since the chunked list last changed or handed out mutable access to
+           * its elements
+           */
+          bool current{false};
+      };
+
+      struct NoFences {};
+
+      static constexpr bool fenced = enable_fences<ChunkedList>;
+
+      [[no_unique_address]] std::conditional_t<fenced, std::unique_ptr<Fences>, NoFences> fences{};
+
+      /**
+       * @return The allocator each chunk constructs its elements with, rebound from the chunk allocator when it can be,
+       * so stateful allocators such as polymorphic allocators construct elements through the same resource
+       */
+      ValueAllocator make_value_allocator() const;
+
+      /**
+       * @brief Moves every element of another chunked list to the back of the given one one by one, for when the
+       * chunks of the other list can't be relinked as they were allocated by an unequal allocator
+       */
+      void move_elements(ChunkedList &other);
+
+      /**
+       * @brief Links every chunk of another chunked list after the back chunk in O(1), leaving the other list empty.
+       * The chunk allocators of both lists must compare equal
+       */
+      void relink_chunks(ChunkedList &other);
+
+      /**
+       * @brief Allocates a chunk and constructs it with the given arguments, without linking it
+       * @return A pointer to the newly constructed chunk
+       */
+      template<typename... Args>
+      Chunk *allocate_chunk(Args &&...args);
+
+      /**
+       * @brief Allocates a chunk, constructs it with the given arguments and links it after the back chunk
+       * @return A pointer to the newly linked back chunk
+       */
+      template<typename... Args>
+      Chunk *push_chunk(Args &&...args);
+
+      /**
+       * @brief Destroys and deallocates a chunk which has already been unlinked from the chunked list
+       */
+      void deallocate_chunk(Chunk *chunkPtr);
+
+      /**
+       * @brief Links the given number of empty chunks to an empty chunked list, then fills each through the
+       * constructor callable. When runs_in_parallel holds for the elements and the allocator's instances are always
+       * equal, the chunks are split between threads. The chunked list is cleared if any construction throws
+       * @tparam Constructor A callable taking a chunk and its position, constructing the elements of the chunk
+       */
+      template<typename Constructor>
+      void construct_chunks(size_t chunks, size_t elements, Constructor construct);
+
+      /**
+       * @brief Grows the chunked list to the given size, first filling the vacant slots of the back chunk and then
+       * appending chunks built through construct_chunks. The chunked list is left unchanged if any construction throws
+       * @tparam Appender A callable taking a chunk which is not full, constructing one element at its back
+       */
+      template<typename Appender>
+      void grow(size_t count, Appender append);
+
+      /**
+       * @brief Prefetches the links and the first elements of a chunk, doing nothing for the null link at either end
+       * of a chunk iterated on its own
+       */
+      static void prefetch_chunk(const Chunk *chunkPtr);
+
+      /**
+       * @return Whether a bulk operation over the given number of elements is split between threads, which it is only
+       * for lists opted in with enable_parallelism once the elements take up utility::parallel_threshold bytes
+       */
+      static constexpr bool runs_in_parallel(size_t elements);
+
+      /**
+       * @brief Calls a function with every chunk from front to back, keeping utility::prefetch_distance chunks
+       * prefetched ahead of the one being visited
+       * @tparam ChunkT Chunk or const Chunk
+       */
+      template<typename ChunkT, typename Function>
+      static void for_each_chunk(ChunkT *sentinelPtr, Function function);
+
+      void invalidate_fences();
+
+      /**
+       * @brief Walks from the front chunk to the chunk holding the element at an index
+       * @param index The index of the element in the chunked list, which becomes its index within the chunk
+       * @tparam ChunkT Chunk or const Chunk
+       */
+      template<typename ChunkT>
+      static ChunkT *chunk_holding(ChunkT *sentinelPtr, size_t &index);
+
+      /**
+       * @brief Compares elements from a position within one chunk against elements from a position within another,
+       * following the links of both and comparing each span shared by the current pair of chunks at once
+       * @param count The number of elements to compare
+       * @param mismatch A flag which stops the comparison early once another thread has found unequal elements
+       * @return Whether every compared element is equal
+       */
+      static bool equal_from(const Chunk *chunkPtr, size_t index, const Chunk *otherChunkPtr, size_t otherIndex,
+                             size_t count, const std::atomic<bool> &mismatch);
+
+      /**
+       * @brief Forgets the fences without freeing them, for a mapped list whose fences were allocated by a process
+       * which has since unmapped it
+       */
+      void forget_fences();
+
+      /**
+       * @brief Frees the fences, for a mapped list which is unmapped without being destroyed
+       */
+      void release_fences();
+
+      /**
+       * @brief Finds the first element for which the predicate is false, in a list partitioned by it. The fences are
+       * binary searched for the chunk holding it when they are current, and otherwise the chunks are walked
+       * @tparam Before A predicate which is true for every element before the partition point
+       */
+      template<typename Before>
+      const_iterator find_partition_point(Before before) const;
+
+      /**
+       * @brief Writes the binary header and the data block of each chunk through a writer callable
+       * @tparam Writer A callable taking a pointer to bytes and a byte count
+       */
+      template<typename Writer>
+      void write_binary_with(Writer write) const;
+
+      /**
+       * @brief Reads a binary header and element bytes through a reader callable straight into new chunks
+       * @tparam Reader A callable taking a pointer to bytes and a byte count, reading exactly that many bytes
+       */
+      template<typename Reader>
+      void read_binary_with(Reader read);
+
       /**
        * @brief A generic chunk iterator for the chunk iterator and const chunk iterator
        * @tparam Mutable Whether the chunk referenced by the iterator can be mutated
@@ -187,6 +450,11 @@ namespace chunked_list {
           ChunkT *chunk{nullptr};
 
         public:
+          /**
+           * @brief Constructs a singular chunk iterator, which may only be assigned to or compared
+           */
+          generic_chunk_iterator() = default;
+
           template<typename ChunkIteratorT>
             requires utility::chunk_iterator<ChunkedList, ChunkIteratorT>
           explicit generic_chunk_iterator(ChunkIteratorT chunkIterator);
@@ -212,12 +480,13 @@ namespace chunked_list {
           using pointer = ChunkT *;
           using reference = ChunkT &;
           using iterator_category = std::bidirectional_iterator_tag;
+          using iterator_concept = std::bidirectional_iterator_tag;
 
           /**
            * @brief Prefix increment operator, incrementing the chunk pointer by one
            * @return The incremented GenericIterator
            */
-          generic_chunk_iterator operator++();
+          generic_chunk_iterator &operator++();
 
           /**
            * @brief Postfix increment operator, incrementing the chunk pointer by one
@@ -229,7 +498,7 @@ namespace chunked_list {
            * @brief Prefix decrement operator, decrement the chunk pointer by one
            * @return The decremented GenericIterator
            */
-          generic_chunk_iterator operator--();
+          generic_chunk_iterator &operator--();
 
           /**
            * @brief Postfix decrement operator, decrementing the chunk pointer by one
@@ -254,14 +523,14 @@ namespace chunked_list {
            * @param offset The number of positions to advance the iterator by
            * @return The iterator advanced forward by the given number of positions
            */
-          generic_chunk_iterator operator+=(size_t offset);
+          generic_chunk_iterator &operator+=(size_t offset);
 
           /**
            * @brief Moves the given iterator backwards by a given number of positions
            * @param offset The number of positions to move the iterator by
            * @return The iterator moved backward by the given number of positions
            */
-          generic_chunk_iterator operator-=(size_t offset);
+          generic_chunk_iterator &operator-=(size_t offset);
 
           /**
            * @brief Compares the given object with another for equality
@@ -284,32 +553,18 @@ namespace chunked_list {
           bool operator!=(const ChunkIteratorType &other) const;
 
           /**
-           * @brief Dereferences the iterator
+           * @brief Dereferences the iterator, which gives the same reference whether or not the iterator is const
            * @return A reference to the chunk, of type ChunkT, stored by the iterator
            */
-          ChunkT &operator*();
-
-          /**
-           * @brief Const dereferences the iterator
-           * @return A const reference to the chunk, of type ChunkT, stored by the iterator
-           */
-          const ChunkT &operator*() const;
+          ChunkT &operator*() const;
 
           /**
            * @brief Allows direct access to the members of the chunk stored within the iterator, of type ChunkT
            * @return A pointer to the chunk stored within the iterator, of type ChunkT
            */
-          ChunkT *operator->();
+          ChunkT *operator->() const;
 
-          /**
-           * @brief Allows direct const access to the members of the chunk stored within the iterator, of type ChunkT
-           * @return A const pointer to the chunk stored within the iterator, of type ChunkT
-           */
-          const ChunkT *operator->() const;
-
-          ChunkT &operator[](size_t n);
-
-          const ChunkT &operator[](size_t n) const;
+          ChunkT &operator[](size_t n) const;
 
           /**
            * @brief Allows the iterator to be converted to a chunk pointer easily
@@ -338,6 +593,11 @@ namespace chunked_list {
           size_t index{0};
 
         public:
+          /**
+           * @brief Constructs a singular iterator, which may only be assigned to or compared
+           */
+          generic_iterator() = default;
+
           template<utility::iterator<ChunkedList> IteratorType>
           explicit generic_iterator(IteratorType iterator);
 
@@ -364,13 +624,14 @@ namespace chunked_list {
           using pointer = ValueT *;
           using reference = ValueT &;
           using iterator_category = std::bidirectional_iterator_tag;
+          using iterator_concept = std::bidirectional_iterator_tag;
 
           /**
            * @brief Prefix increment operator, incrementing the index by one unless it is equal to the ChunkSize, in
            * which case incrementing the chunkIterator member by one
            * @return The incremented generic iterator
            */
-          generic_iterator operator++();
+          generic_iterator &operator++();
 
           /**
            * @brief Prefix increment operator, incrementing the index by one unless it is equal to the ChunkSize, in
@@ -384,7 +645,7 @@ namespace chunked_list {
            * decrementing the chunkIterator member by one
            * @return The decremented generic iterator
            */
-          generic_iterator operator--();
+          generic_iterator &operator--();
 
           /**
            * @brief Postfix decrement operator, decrementing the index by one unless it is equal to 0, in which case
@@ -397,25 +658,25 @@ namespace chunked_list {
            * @param n The number of positions to advance the iterator by
            * @return The iterator advanced forward by a given number of positions
            */
-          generic_iterator operator+(size_t n);
+          generic_iterator operator+(size_t n) const;
 
           /**
            * @param n The number of positions to move the iterator by
            * @return The iterator moved backward by a given number of positions
            */
-          generic_iterator operator-(size_t n);
+          generic_iterator operator-(size_t n) const;
 
           /**
            * @param n The number of positions to advance the iterator by
            * @return The iterator advanced forward by the given number of positions
            */
-          generic_iterator operator+=(size_t n);
+          generic_iterator &operator+=(size_t n);
 
           /**
            * @param n The number of positions to move the iterator by
            * @return The iterator moved backward by the given number of positions
            */
-          generic_iterator operator-=(size_t n);
+          generic_iterator &operator-=(size_t n);
 
           /**
            * @tparam IteratorType The type of the other object
@@ -436,33 +697,18 @@ namespace chunked_list {
           bool operator!=(const IteratorType &other) const;
 
           /**
-           * @brief Dereferences the iterator
+           * @brief Dereferences the iterator, which gives the same reference whether or not the iterator is const
            * @return A reference to value, of type ValueT, stored within the current chunk at the current index
            */
-          ValueT &operator*();
-
-          /**
-           * @brief Dereferences the iterator (const)
-           * @return A const reference to the value, of type ValueT, stored within the current chunk at the current
-           * index
-           */
-          const ValueT &operator*() const;
+          ValueT &operator*() const;
 
           /**
            * @brief Allows direct access to the members of the object referenced by the iterator, of type ValueT
            * @return A pointer to the object referenced by the iterator, of type ValueT
            */
-          ValueT *operator->();
+          ValueT *operator->() const;
 
-          /**
-           * @brief Allows direct const access to the members of the object referenced by the iterator, of type ValueT
-           * @return A const pointer to the object referenced by the iterator, of type ValueT
-           */
-          const ValueT *operator->() const;
-
-          ValueT &operator[](size_t n);
-
-          const ValueT &operator[](size_t n) const;
+          ValueT &operator[](size_t n) const;
 
           /**
            * @brief A get function, returning the private index member
@@ -501,12 +747,95 @@ namespace chunked_list {
        */
       ChunkedList();
 
+      /**
+       * @brief Constructs an empty chunked list which allocates its chunks with a copy of the given allocator
+       * @param chunkAllocator The allocator used for the allocation and deallocation of chunks
+       */
+      explicit ChunkedList(const Allocator<Chunk> &chunkAllocator);
+
       /**
        * @brief A convenience constructor for the chunked list, allowing items to be added on initialization
        * @param initializerList The initializer list used to determine how the initial chunks will be populated
        */
       ChunkedList(std::initializer_list<T> initializerList);
 
+      /**
+       * @brief Populates the chunked list from an initializer list, allocating its chunks with the given allocator
+       * @param initializerList The initializer list used to determine how the initial chunks will be populated
+       * @param chunkAllocator The allocator used for the allocation and deallocation of chunks
+       */
+      ChunkedList(std::initializer_list<T> initializerList, const Allocator<Chunk> &chunkAllocator);
+
+      /**
+       * @brief Constructs a chunked list of count copies of a value, allocating every chunk before filling them, in
+       * parallel for large counts of lists opted in with enable_parallelism
+       * @param count The number of elements
+       * @param value The value each element is copied from
+       * @param chunkAllocator The allocator used for the allocation and deallocation of chunks
+       */
+      ChunkedList(size_t count, const T &value, const Allocator<Chunk> &chunkAllocator = Allocator<Chunk>{});
+
+      /**
+       * @brief Constructs a chunked list of count elements, each the result of calling the generator with its index,
+       * allocating every chunk before filling them, in parallel for large counts of lists opted in with
+       * enable_parallelism
+       * @tparam Generator A callable taking an index and returning the element at it, which may be called from
+       * several threads at once
+       * @param count The number of elements
+       * @param generator The callable generating each element
+       * @param chunkAllocator The allocator used for the allocation and deallocation of chunks
+       */
+      template<typename Generator>
+        requires std::is_invocable_r_v<T, Generator &, size_t>
+      ChunkedList(size_t count, Generator generator, const Allocator<Chunk> &chunkAllocator = Allocator<Chunk>{});
+
+      /**
+       * @brief The copy constructor for the chunked list, copying each chunk of the other list with the allocator
+       * selected by select_on_container_copy_construction
+       * @param other The chunked list which will be copied
+       */
+      ChunkedList(const ChunkedList &other);
+
+      /**
+       * @brief Copies each chunk of another chunked list, allocating the copies with the given allocator
+       * @param other The chunked list which will be copied
+       * @param chunkAllocator The allocator used for the allocation and deallocation of chunks
+       */
+      ChunkedList(const ChunkedList &other, const Allocator<Chunk> &chunkAllocator);
+
+      /**
+       * @brief The move constructor for the chunked list, relinking the chunks of the other list in O(1)
+       * @param other The chunked list whose chunks will be taken, left empty afterwards
+       */
+      ChunkedList(ChunkedList &&other) noexcept;
+
+      /**
+       * @brief Takes the chunks of another chunked list when its allocator equals the given one, otherwise moving its
+       * elements one by one into chunks allocated with the given allocator
+       * @param other The chunked list whose elements will be taken, left empty afterwards
+       * @param chunkAllocator The allocator used for the allocation and deallocation of chunks
+       */
+      ChunkedList(ChunkedList &&other, const Allocator<Chunk> &chunkAllocator);
+
+      /**
+       * @brief The copy assignment operator, copying the allocator of the other list too when it propagates on copy
+       * assignment. The copy is made before the chunked list is cleared, so it is left unchanged if copying throws
+       * @param other The chunked list which will be copied
+       * @return A reference to the given chunked list
+       */
+      ChunkedList &operator=(const ChunkedList &other);
+
+      /**
+       * @brief The move assignment operator, clearing the chunked list before taking the chunks of the other list.
+       * Unless the allocator propagates on move assignment or the allocators are equal, the elements are moved one by
+       * one instead
+       * @param other The chunked list whose chunks will be taken, left empty afterwards
+       * @return A reference to the given chunked list
+       */
+      ChunkedList &operator=(ChunkedList &&other) noexcept(
+        ChunkAllocatorTraits::propagate_on_container_move_assignment::value ||
+        ChunkAllocatorTraits::is_always_equal::value);
+
       /**
        * @brief The destructor for the chunked list, deallocating each chunk starting from the back
        */
@@ -719,6 +1048,33 @@ namespace chunked_list {
        */
       void pop_back();
 
+      /**
+       * @brief Pops the given number of elements from the back of the chunked list, as truncate does
+       * @param count The number of elements to pop, which must not exceed the size of the chunked list
+       */
+      void pop_back(size_t count);
+
+      /**
+       * @brief Shrinks the chunked list to the given size, unlinking every chunk past the new back chunk at once
+       * before deallocating them, and destroying the excess elements of the new back chunk together. Does nothing
+       * when the chunked list is no larger than the given size
+       */
+      void truncate(size_t count);
+
+      /**
+       * @brief Shrinks the chunked list as truncate does, or grows it with value initialized elements, filling the
+       * vacant slots of the back chunk and then constructing whole chunks, in parallel for large lists opted in with
+       * enable_parallelism
+       */
+      void resize(size_t count);
+
+      /**
+       * @brief Shrinks the chunked list as truncate does, or grows it with copies of a value, filling the vacant slots
+       * of the back chunk and then constructing whole chunks, in parallel for large lists opted in with
+       * enable_parallelism
+       */
+      void resize(size_t count, const T &value);
+
       /**
        * @brief Erases an item from the chunked list using an iterator
        * @param it The iterator to be erased
@@ -743,6 +1099,56 @@ namespace chunked_list {
        */
       void clear();
 
+      /**
+       * @brief Replaces the elements of the chunked list with count copies of a value, which are constructed before
+       * the old elements are destroyed
+       */
+      void assign(size_t count, const T &value);
+
+      /**
+       * @brief Assigns a value to every element of the chunked list, in parallel for large lists opted in with
+       * enable_parallelism
+       */
+      void fill(const T &value);
+
+      /**
+       * @brief Appends every chunk of another chunked list to the back of the given one, of O(1) complexity. When the
+       * chunk allocators of the lists compare unequal, each element is moved instead, in O(n)
+       * @param other The chunked list whose chunks will be relinked, left empty afterwards
+       */
+      void splice(ChunkedList &other);
+
+      void splice(ChunkedList &&other);
+
+      /**
+       * @brief Exchanges the chunks of two chunked lists in O(1), exchanging their allocators too when they propagate
+       * on swap; otherwise the allocators must be equal
+       * @param other The chunked list whose chunks will be exchanged
+       */
+      void swap(ChunkedList &other) noexcept;
+
+      /**
+       * @return A copy of the allocator used for the allocation and deallocation of chunks
+       */
+      Allocator<Chunk> get_allocator() const;
+
+      /**
+       * @brief Splits the chunked list in two, moving the element referenced by the iterator and every element after
+       * it into a new chunked list. Whole chunks are relinked; a chunk is only split, in O(ChunkSize), when the
+       * iterator references the middle of it
+       * @param position The iterator referencing the first element of the returned list
+       * @return A chunked list containing the elements from the position to the end
+       */
+      ChunkedList split_at(iterator position);
+
+      /**
+       * @brief Transfers a range of chunks to a new chunked list without moving any elements
+       * @param first The chunk iterator for the first chunk to be transferred (inclusive)
+       * @param last The chunk iterator for the chunk after the last to be transferred (exclusive)
+       * @return A chunked list containing the transferred chunks
+       */
+      ChunkedList extract_chunks(chunk_iterator first, chunk_iterator last);
+
       /**
        * @brief Sorts the chunked list with a template-decided comparison class and sorting algorithm
        * @tparam Compare The comparison functor used in the sorting algorithm
@@ -752,18 +1158,119 @@ namespace chunked_list {
       void sort();
 
       /**
-       * @return The number of (chunks - 1) multiplied by the chunk size, plus the back next index of the back chunk
+       * @brief Builds the fences of an already sorted chunked list, a compact array of the first element of each chunk
+       * which the sorted searches binary search, as sort does by itself. Every member function which changes the list
+       * or hands out mutable access to its elements drops them
+       */
+      void build_fences()
+        requires enable_fences<ChunkedList>;
+
+      /**
+       * @brief Finds the first element which isn't ordered before the value, in a list sorted by the same comparison.
+       * With current fences this binary searches them and then a single chunk, and otherwise walks the chunks first
+       * @tparam Compare The comparison functor the chunked list is sorted by
+       * @param value The value to search for
+       * @return A const iterator to the element, or the end iterator when every element is ordered before the value
+       */
+      template<typename Compare = std::less<T>>
+      const_iterator lower_bound(const T &value) const;
+
+      /**
+       * @brief Finds the first element which the value is ordered before, in a list sorted by the same comparison
+       * @tparam Compare The comparison functor the chunked list is sorted by
+       * @param value The value to search for
+       * @return A const iterator to the element, or the end iterator when no element is ordered after the value
+       */
+      template<typename Compare = std::less<T>>
+      const_iterator upper_bound(const T &value) const;
+
+      /**
+       * @tparam Compare The comparison functor the chunked list is sorted by
+       * @param value The value to search for
+       * @return The lower and upper bounds of the value, between which every element is equivalent to it
+       */
+      template<typename Compare = std::less<T>>
+      std::pair<const_iterator, const_iterator> equal_range(const T &value) const;
+
+      /**
+       * @tparam Compare The comparison functor the chunked list is sorted by
+       * @param value The value to search for
+       * @return Whether an element equivalent to the value is stored in the sorted chunked list
+       */
+      template<typename Compare = std::less<T>>
+      bool contains_sorted(const T &value) const;
+
+      /**
+       * @brief Recomputes the zone map of every chunk which handed out a mutable reference to one of its elements
+       */
+      void rebuild_zone_maps()
+        requires enable_zone_maps<ChunkedList>;
+
+      /**
+       * @brief Counts the elements within [low, high]. Chunks whose zone map lies outside the range are skipped, and
+       * chunks whose zone map lies within it are counted without reading their elements
+       * @return The number of elements which are neither less than low nor greater than high
+       */
+      size_t count_between(const T &low, const T &high) const
+        requires std::totally_ordered<T>;
+
+      /**
+       * @brief Finds the first element within [low, high], skipping every chunk whose zone map lies outside the range
+       * @return A const iterator to the element, or the end iterator when no element lies within the range
+       */
+      const_iterator find_between(const T &low, const T &high) const
+        requires std::totally_ordered<T>;
+
+      /**
+       * @brief Calls a function with every element within [low, high] from front to back, skipping every chunk whose
+       * zone map lies outside the range
+       * @tparam Function A callable taking a const reference to an element
+       */
+      template<typename Function>
+      void for_each_between(const T &low, const T &high, Function function) const
+        requires std::totally_ordered<T>;
+
+      /**
+       * @return The number of elements stored across every chunk of the chunked list
        */
       size_t size() const;
 
       /**
-       * @return Whether the front chunk's next index is 0
+       * @return Whether the chunked list stores no chunks
        */
       bool empty() const;
 
       /**
+       * @return The number of chunks held by the chunked list, and the bytes used by elements versus the bytes
+       * allocated for chunks
+       */
+      MemoryUsage memory_usage() const;
+
+      /**
+       * @return The fraction of the element slots across every chunk which hold an element, or 0 without any chunks
+       */
+      double fill_ratio() const;
+
+      /**
+       * @return The statistics shared by every chunked list of this type
+       */
+      static const Statistics &statistics()
+        requires enable_statistics<ChunkedList>;
+
+      /**
+       * @brief Sets every statistics counter shared by chunked lists of this type to 0
+       */
+      static void reset_statistics()
+        requires enable_statistics<ChunkedList>;
+
+      /**
+       * @brief Compares the lists a span of both chunk chains at a time, with memcmp when the elements are bytewise
+       * comparable, after first comparing their sizes. Lists opted in with enable_parallelism whose elements take up
+       * at least utility::parallel_threshold bytes are compared by several threads, which all stop once any of them
+       * finds a mismatch
        * @param other The chunked list to compare the given one to for equality
-       * @return Whether each chunk has the same elements and the lists are both of the same size
+       * @return Whether the lists are of the same size and have equal elements in the same order, however the elements
+       * are split between chunks
        */
       bool operator==(const ChunkedList &other) const;
 
@@ -774,17 +1281,8 @@ namespace chunked_list {
       bool operator!=(const ChunkedList &other) const;
 
       /**
-       * @brief Inserts the chunked list to an ostream
-       * @param os The ostream to insert the elements of the chunked list to
-       * @param chunkedList The chunked list object
-       * @return The ostream object given by the os argument
-       */
-      template<typename U, size_t>
-        requires utility::can_insert<std::ostream, U>
-      friend std::ostream &operator<<(std::ostream &os, ChunkedList &chunkedList);
-
-      /**
-       * @brief Concatenates the elements of the chunked list
+       * @brief Concatenates the elements of the chunked list. Numbers joined into a std::string are written with
+       * std::to_chars after measuring the result, so the string is allocated once
        * @tparam OutputStream The ostream to use for inserting elements
        * @tparam DelimiterType The type of string used to store the delimiter
        * @param delimiter The divider between each element
@@ -793,10 +1291,169 @@ namespace chunked_list {
       template<typename OutputStream = std::ostringstream, typename DelimiterType = std::string>
         requires utility::can_insert<OutputStream, T> && utility::can_insert<OutputStream, DelimiterType> &&
                  utility::can_stringify<OutputStream>
-      auto concat(DelimiterType delimiter = ", ") -> utility::DeduceStreamStringType<OutputStream>;
+      auto concat(DelimiterType delimiter = ", ") const -> utility::DeduceStreamStringType<OutputStream>;
+
+      /**
+       * @brief Writes a small header followed by the data block of each chunk to an ostream, in the native byte
+       * order of the machine
+       * @param os The ostream which the binary representation of the chunked list will be written to
+       */
+      void write_binary(std::ostream &os) const
+        requires std::is_trivially_copyable_v<T>;
+
+      /**
+       * @brief Replaces the elements of the chunked list with those written by write_binary, reading the bytes
+       * directly into freshly allocated chunks without parsing each element
+       * @param is The istream which the binary representation of the chunked list will be read from
+       */
+      void read_binary(std::istream &is)
+        requires std::is_trivially_copyable_v<T>;
+
+#if CHUNKED_LIST_POSIX
+      /**
+       * @brief Writes a small header followed by the data block of each chunk to a file descriptor
+       * @param fd The file descriptor which the binary representation of the chunked list will be written to
+       */
+      void write_binary(int fd) const
+        requires std::is_trivially_copyable_v<T>;
+
+      /**
+       * @brief Replaces the elements of the chunked list with those written by write_binary to a file descriptor
+       * @param fd The file descriptor which the binary representation of the chunked list will be read from
+       */
+      void read_binary(int fd)
+        requires std::is_trivially_copyable_v<T>;
+#endif
+
+      /**
+       * @brief Calls a function with the data block of each chunk, from front to back
+       * @tparam Function A callable taking a pointer to the first element of a chunk and the number of elements in it
+       * @param function The function called with each segment of the chunked list
+       */
+      template<typename Function>
+      void for_each_segment(Function function);
+
+      template<typename Function>
+      void for_each_segment(Function function) const;
+
+#if CHUNKED_LIST_POSIX
+      /**
+       * @return An iovec referencing the data block of each chunk, usable with writev without copying any element
+       */
+      std::vector<iovec> as_iovecs() const
+        requires std::is_trivially_copyable_v<T>;
+
+      /**
+       * @brief Writes the data block of each chunk to a file descriptor with writev, without copying any element
+       * @param fd The file descriptor which the elements of the chunked list will be written to
+       */
+      void write_segments(int fd) const
+        requires std::is_trivially_copyable_v<T>;
+
+      /**
+       * @brief Appends up to count elements read from a file descriptor with a single readv, reading directly into
+       * the free space of the back chunk and into chunks allocated beforehand, whose zone maps are then rebuilt
+       * @param fd The file descriptor which the elements will be read from
+       * @param count The maximum number of elements which will be read
+       * @return The number of elements appended, which is 0 at the end of the file
+       */
+      size_t read_segments(int fd, size_t count)
+        requires std::is_trivially_copyable_v<T>;
+#endif
   };
+
+  /**
+   * @brief Inserts the chunked list to an ostream, as its elements separated by commas within square brackets. Numbers
+   * are written with std::to_chars through a stack buffer when the ostream uses its default formatting
+   * @param os The ostream to insert the elements of the chunked list to
+   * @param chunkedList The chunked list object
+   * @return The ostream object given by the os argument
+   */
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+    requires utility::can_insert<std::ostream, T>
+  std::ostream &operator<<(std::ostream &os, const ChunkedList<T, ChunkSize, Allocator> &chunkedList);
+
+  /**
+   * @brief Exchanges the chunks of two chunked lists in O(1)
+   */
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void swap(ChunkedList<T, ChunkSize, Allocator> &left, ChunkedList<T, ChunkSize, Allocator> &right) noexcept;
+
+  namespace pmr {
+    /**
+     * @brief A chunked list allocating its chunks, and constructing its elements, through a memory resource
+     */
+    template<typename T, size_t ChunkSize = 32>
+    using ChunkedList = chunked_list::ChunkedList<T, ChunkSize, std::pmr::polymorphic_allocator>;
+  } // namespace pmr
+
+  namespace utility {
+    /**
+     * @return The size in bytes of each chunk of a chunked list, including the links and index stored beside the
+     * elements
+     */
+    template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+    constexpr size_t chunk_bytes();
+
+    /**
+     * @return The greatest chunk size whose chunks fit within a number of bytes, or 0 when not even one element fits
+     */
+    template<typename T, size_t Bytes, template<typename> typename Allocator>
+    constexpr size_t chunk_size_for_bytes();
+  } // namespace utility
+
+  /**
+   * @brief Computes the chunk size of a chunked list from a byte budget for each whole chunk, rather than a number of
+   * elements
+   * @tparam T The type of elements to be stored in the chunked list
+   * @tparam Bytes The maximum size of each chunk in bytes, such as a multiple of the cache line size or a page
+   * @tparam Allocator The allocator used for the allocation and deallocation of data
+   */
+  template<typename T, size_t Bytes, template<typename> typename Allocator = std::allocator>
+  struct ChunkBytes {
+      /**
+       * @brief The number of elements in each chunk
+       */
+      static constexpr size_t chunk_size = utility::chunk_size_for_bytes<T, Bytes, Allocator>();
+
+      static_assert(chunk_size > 0, "Chunk Bytes must fit a chunk holding at least one element");
+  };
+
+  /**
+   * @brief A chunked list whose chunks hold as many elements as fit within a byte budget
+   */
+  template<typename T, size_t Bytes, template<typename> typename Allocator = std::allocator>
+  using ChunkedListBytes = ChunkedList<T, ChunkBytes<T, Bytes, Allocator>::chunk_size, Allocator>;
 } // namespace chunked_list
 
+#if CHUNKED_LIST_FORMAT
+/**
+ * @brief Formats a chunked list as its elements separated by commas within square brackets, forwarding the format
+ * specification to the formatter of each element
+ */
+template<typename T, size_t ChunkSize, template<typename> typename Allocator, typename CharT>
+struct std::formatter<chunked_list::ChunkedList<T, ChunkSize, Allocator>, CharT> {
+    std::formatter<T, CharT> element_formatter;
+
+    constexpr typename std::basic_format_parse_context<CharT>::iterator
+    parse(std::basic_format_parse_context<CharT> &context);
+
+    template<typename FormatContext>
+    typename FormatContext::iterator format(const chunked_list::ChunkedList<T, ChunkSize, Allocator> &chunkedList,
+                                           FormatContext &context) const;
+};
+#endif
+
+/**
+ * @brief Hashes a chunked list, feeding the bytes of each chunk to the hasher in bulk when the elements are bytewise
+ * comparable, or else the std::hash of each element, so lists which compare equal hash equally whatever their chunks
+ */
+template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  requires chunked_list::utility::bytewise_comparable<T> || chunked_list::utility::hashable<T>
+struct std::hash<chunked_list::ChunkedList<T, ChunkSize, Allocator>> {
+    size_t operator()(const chunked_list::ChunkedList<T, ChunkSize, Allocator> &chunkedList) const;
+};
+
 /**
  * @brief Standard global begin function for chunked list
  * @tparam ChunkedListType The type of chunked list
@@ -932,5 +1589,7 @@ ConstReverseIteratorType crend(const ChunkedListType &chunkedList) noexcept;
 #include "detail/ChunkedList.tpp"
 #include "detail/ChunkedListSlice.hpp"
 #include "detail/ChunkedListSlice.tpp"
+#include "detail/ChunkedListViews.hpp"
+#include "detail/ChunkedListViews.tpp"
 #include "detail/generic_iterator.tpp"
 #include "detail/utility.tpp"
@@ -11,6 +11,8 @@ namespace chunked_list {
     public:
       using DerivedChunkedList::chunk_count;
 
+      using DerivedChunkedList::element_count;
+
       using DerivedChunkedList::ValueAllocator;
 
       using DerivedChunkedList::ValueAllocatorTraits;
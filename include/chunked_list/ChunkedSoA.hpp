@@ -0,0 +1,254 @@
+#pragma once
+
+#include <span>
+#include <tuple>
+
+#include "ChunkedList.hpp"
+
+namespace chunked_list {
+  /**
+   * @class BasicChunkedSoA
+   * @brief A linked list of fixed-size chunks like the chunked list, storing records of several fields with each field
+   * in its own array within each chunk, so a scan over one field touches only that field's memory.
+   *
+   * Elements are accessed through proxy references, being tuples of references to each field, and the fields of each
+   * chunk can be scanned as spans.
+   *
+   * @tparam ChunkSize The number of records in each chunk
+   * @tparam Allocator The allocator used for the allocation and deallocation of chunks
+   * @tparam Ts The types of the fields of each record
+   */
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  class BasicChunkedSoA {
+      static_assert(ChunkSize > 0, "Chunk Size must be greater than 0");
+      static_assert(sizeof...(Ts) > 0, "A record must have at least one field");
+
+    public:
+      template<size_t Field>
+      using field_type = std::tuple_element_t<Field, std::tuple<Ts...>>;
+
+      using value_type = std::tuple<Ts...>;
+      using reference = std::tuple<Ts &...>;
+      using const_reference = std::tuple<const Ts &...>;
+
+      static constexpr size_t chunk_size = ChunkSize;
+      static constexpr size_t field_count = sizeof...(Ts);
+
+    private:
+      struct ChunkLinks {
+          ChunkLinks *prevChunk;
+          ChunkLinks *nextChunk;
+      };
+
+      /**
+       * @brief Uninitialized storage for one field of every record in a chunk
+       */
+      template<typename FieldT>
+      struct FieldArray {
+          alignas(FieldT) std::byte bytes[sizeof(FieldT) * ChunkSize];
+
+          FieldT *data();
+
+          const FieldT *data() const;
+      };
+
+    public:
+      /**
+       * @brief A chunk holding one array for each field, of which the first size() records are constructed
+       */
+      class Chunk : public ChunkLinks {
+          friend class BasicChunkedSoA;
+
+          size_t recordCount{0};
+          std::tuple<FieldArray<Ts>...> fields;
+
+          Chunk(ChunkLinks *prevChunk, ChunkLinks *nextChunk);
+
+          template<typename... Args>
+          void emplace_back(Args &&...args);
+
+          void pop_back();
+
+        public:
+          Chunk(const Chunk &) = delete;
+
+          Chunk &operator=(const Chunk &) = delete;
+
+          ~Chunk();
+
+          size_t size() const;
+
+          reference operator[](size_t index);
+
+          const_reference operator[](size_t index) const;
+
+          /**
+           * @return A span over one field of every record in the chunk
+           */
+          template<size_t Field>
+          std::span<field_type<Field>> field();
+
+          template<size_t Field>
+          std::span<const field_type<Field>> field() const;
+      };
+
+      /**
+       * @brief A bidirectional iterator over the records, dereferencing to proxy references
+       * @tparam Mutable Whether the records referenced by the iterator can be mutated
+       */
+      template<bool Mutable>
+      class generic_iterator {
+          friend class BasicChunkedSoA;
+
+          template<bool>
+          friend class generic_iterator;
+
+          using LinksT = std::conditional_t<Mutable, ChunkLinks, const ChunkLinks>;
+          using ChunkT = std::conditional_t<Mutable, Chunk, const Chunk>;
+
+          LinksT *chunk{nullptr};
+          size_t index{0};
+
+          generic_iterator(LinksT *chunkPtr, size_t index);
+
+        public:
+          using value_type = BasicChunkedSoA::value_type;
+          using reference = std::conditional_t<Mutable, BasicChunkedSoA::reference, const_reference>;
+          using difference_type = std::ptrdiff_t;
+          using iterator_category = std::bidirectional_iterator_tag;
+          using iterator_concept = std::bidirectional_iterator_tag;
+
+          generic_iterator() = default;
+
+          /**
+           * @brief Converts a mutable iterator to a const one
+           */
+          template<bool OtherMutable>
+            requires(OtherMutable && !Mutable)
+          generic_iterator(const generic_iterator<OtherMutable> &other);
+
+          reference operator*() const;
+
+          /**
+           * @return The value of one field of the record referenced by the iterator
+           */
+          template<size_t Field>
+          std::conditional_t<Mutable, field_type<Field>, const field_type<Field>> &get() const;
+
+          generic_iterator &operator++();
+
+          generic_iterator operator++(int);
+
+          generic_iterator &operator--();
+
+          generic_iterator operator--(int);
+
+          bool operator==(const generic_iterator &other) const;
+      };
+
+      using iterator = generic_iterator<true>;
+      using const_iterator = generic_iterator<false>;
+
+    private:
+      using ChunkAllocator = Allocator<Chunk>;
+      using ChunkAllocatorTraits = std::allocator_traits<ChunkAllocator>;
+
+      [[no_unique_address]] ChunkAllocator chunk_allocator{};
+      ChunkLinks sentinel{&sentinel, &sentinel};
+      size_t chunk_count{0};
+      size_t element_count{0};
+
+      /**
+       * @brief Finds the chunk holding a record, walking from whichever end of the chunks is nearer
+       * @param index The index of the record, which is replaced by its index within the chunk
+       */
+      Chunk *find_chunk(size_t &index) const;
+
+      /**
+       * @brief Allocates a chunk and links it after the back chunk
+       */
+      Chunk *push_chunk();
+
+      void pop_chunk();
+
+    public:
+      BasicChunkedSoA() = default;
+
+      BasicChunkedSoA(const BasicChunkedSoA &other);
+
+      /**
+       * @brief Takes the chunks of the other container, leaving it empty
+       */
+      BasicChunkedSoA(BasicChunkedSoA &&other) noexcept;
+
+      BasicChunkedSoA &operator=(const BasicChunkedSoA &other);
+
+      BasicChunkedSoA &operator=(BasicChunkedSoA &&other) noexcept;
+
+      ~BasicChunkedSoA();
+
+      /**
+       * @brief Appends a record constructed from one argument per field
+       */
+      template<typename... Args>
+        requires(sizeof...(Args) == sizeof...(Ts))
+      void emplace_back(Args &&...args);
+
+      void push_back(const value_type &record);
+
+      void push_back(value_type &&record);
+
+      void pop_back();
+
+      void clear();
+
+      /**
+       * @brief Accesses a record by index, walking the chunks before it
+       * @return A proxy reference to the fields of the record
+       */
+      reference operator[](size_t index);
+
+      const_reference operator[](size_t index) const;
+
+      /**
+       * @brief Accesses one field of a record by index, walking the chunks before it
+       */
+      template<size_t Field>
+      field_type<Field> &get(size_t index);
+
+      template<size_t Field>
+      const field_type<Field> &get(size_t index) const;
+
+      /**
+       * @brief Calls the function with a span over the given field of each chunk in order, so the scan runs over
+       * contiguous arrays of a single field
+       * @tparam Field The index of the field which will be scanned
+       * @param function A callable taking a span of the field type
+       */
+      template<size_t Field, typename Function>
+      void for_each_span(Function function);
+
+      template<size_t Field, typename Function>
+      void for_each_span(Function function) const;
+
+      iterator begin();
+
+      const_iterator begin() const;
+
+      iterator end();
+
+      const_iterator end() const;
+
+      size_t size() const;
+
+      bool empty() const;
+  };
+
+  /**
+   * @brief A structure-of-arrays chunked container with the default chunk size and allocator
+   */
+  template<typename... Ts>
+  using ChunkedSoA = BasicChunkedSoA<32, std::allocator, Ts...>;
+} // namespace chunked_list
+
+#include "detail/ChunkedSoA.tpp"
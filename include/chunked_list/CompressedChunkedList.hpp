@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ChunkedList.hpp"
+
+namespace chunked_list {
+  /**
+   * @class CompressedChunkedList
+   * @brief A chunked list of integers whose chunks can be frozen into a compressed form, for append-only series which
+   * are rarely read once written.
+   *
+   * Freezing packs every chunk but the back one into a block, encoded either as offsets from the smallest value of the
+   * chunk (frame of reference) or as offsets between consecutive values (delta), whichever needs fewer bits per value,
+   * and bit-packs the offsets. The back chunk always stays uncompressed, so appends are unaffected. Frozen blocks are
+   * decoded a whole block at a time when scanned, and thawing decodes every block back into chunks.
+   *
+   * @tparam T The integral type of elements to be stored, other than bool
+   * @tparam ChunkSize The number of elements in each chunk, and so in each frozen block
+   * @tparam Allocator The allocator used for the allocation and deallocation of uncompressed chunks
+   */
+  template<utility::integer T, size_t ChunkSize = 128, template<typename> typename Allocator = std::allocator>
+  class CompressedChunkedList {
+      using UnsignedT = std::make_unsigned_t<T>;
+      using ChunkedListT = ChunkedList<T, ChunkSize, Allocator>;
+
+      enum class Encoding : uint8_t { FrameOfReference, Delta };
+
+      /**
+       * @brief A frozen chunk of ChunkSize values, bit-packed as offsets from a reference
+       */
+      struct FrozenBlock {
+          Encoding encoding;
+          uint8_t bitWidth;
+
+          /**
+           * @brief The smallest value for frame of reference encoding, or the smallest delta for delta encoding
+           */
+          UnsignedT reference;
+
+          /**
+           * @brief The first value for delta encoding, whose deltas start from the second value
+           */
+          UnsignedT first;
+
+          std::vector<uint64_t> words;
+      };
+
+      std::vector<FrozenBlock> frozen;
+      ChunkedListT hot;
+
+      static FrozenBlock encode(const T *values);
+
+      /**
+       * @brief Decodes every value of a block into the output array of ChunkSize values
+       */
+      static void decode(const FrozenBlock &block, T *output);
+
+      static void pack(std::vector<uint64_t> &words, const UnsignedT *offsets, size_t count, uint8_t bitWidth);
+
+      static UnsignedT unpack(const std::vector<uint64_t> &words, size_t index, uint8_t bitWidth);
+
+    public:
+      using value_type = T;
+
+      static constexpr size_t chunk_size = ChunkSize;
+
+      CompressedChunkedList() = default;
+
+      void push_back(T value);
+
+      /**
+       * @brief Removes the last element, thawing the last frozen block first when no uncompressed elements are left
+       */
+      void pop_back();
+
+      void clear();
+
+      /**
+       * @brief Accesses an element by index, decoding only that element of a frame of reference block, and the values
+       * before it in a delta block
+       * @return A copy of the element
+       */
+      T operator[](size_t index) const;
+
+      /**
+       * @brief Compresses every uncompressed chunk except the back one into frozen blocks
+       */
+      void freeze();
+
+      /**
+       * @brief Decodes every frozen block back into uncompressed chunks
+       */
+      void thaw();
+
+      /**
+       * @brief Calls a function with the values of each frozen block, decoded into a buffer one block at a time, and
+       * then with the data block of each uncompressed chunk, from front to back
+       * @tparam Function A callable taking a pointer to the first element of a segment and the number of elements in it
+       * @param function The function called with each segment of the list
+       */
+      template<typename Function>
+      void for_each_segment(Function function) const;
+
+      size_t size() const;
+
+      bool empty() const;
+
+      /**
+       * @return The number of chunks which are frozen
+       */
+      size_t frozen_chunks() const;
+
+      /**
+       * @return The number of chunks and frozen blocks, the bytes which the elements would occupy uncompressed, and the
+       * bytes allocated for frozen blocks and uncompressed chunks
+       */
+      MemoryUsage memory_usage() const;
+  };
+} // namespace chunked_list
+
+#include "detail/CompressedChunkedList.tpp"
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "ChunkedList.hpp"
+#include "detail/IndexIterator.hpp"
+
+namespace chunked_list {
+  /**
+   * @class CowChunkedList
+   * @brief A chunked list whose chunks are reference counted and shared between copies, so a snapshot costs one
+   * pointer copy per chunk rather than a copy of every element.
+   *
+   * A copy shares every chunk with the list it was copied from. Mutating an element through a non-const accessor, or
+   * appending to or popping from a shared back chunk, first clones the touched chunk, leaving every other holder of it
+   * unaffected. Distinct lists sharing chunks can be used from different threads at once, as with std::shared_ptr,
+   * so a snapshot can be handed to a reader thread while the writer carries on.
+   *
+   * A chunk which has handed out a mutable reference to one of its elements, through a non-const accessor or
+   * emplace_back, is never shared again, as writes through that reference would reach every copy. Copies clone such
+   * chunks instead, so a snapshot stays unaffected by references taken before it.
+   *
+   * @tparam T The type of elements to be stored
+   * @tparam ChunkSize The number of elements in each chunk
+   * @tparam Allocator The allocator used for the allocation and deallocation of chunks, whose instances must all be
+   * able to free each other's chunks
+   */
+  template<typename T, size_t ChunkSize = 32, template<typename> typename Allocator = std::allocator>
+  class CowChunkedList {
+      static_assert(ChunkSize > 0, "Chunk Size must be greater than 0");
+
+      /**
+       * @brief A chunk owned jointly by every list holding a pointer to it
+       */
+      struct SharedChunk {
+          std::atomic<size_t> references{1};
+          size_t count{0};
+
+          /**
+           * @brief Whether a mutable reference into the chunk has been handed out. Only a chunk held by a single list
+           * is ever marked, so copies of that list read it without racing
+           */
+          bool unshareable{false};
+
+          alignas(T) std::byte storage[sizeof(T) * ChunkSize];
+
+          T *data();
+
+          const T *data() const;
+      };
+
+      using ChunkAllocator = Allocator<SharedChunk>;
+      using ChunkAllocatorTraits = std::allocator_traits<ChunkAllocator>;
+
+      [[no_unique_address]] ChunkAllocator chunk_allocator{};
+      std::vector<SharedChunk *> chunks;
+      size_t element_count{0};
+
+      SharedChunk *allocate_chunk();
+
+      /**
+       * @brief Allocates a chunk holding copies of the elements of another, held only by the given list
+       */
+      SharedChunk *clone_chunk(const SharedChunk *chunk);
+
+      /**
+       * @brief Drops a reference to a chunk, destroying its elements and freeing it when it was the last one
+       */
+      void release(SharedChunk *chunk);
+
+      /**
+       * @brief Clones the chunk at the given position when it is shared, so it can be mutated in place
+       * @return The chunk at the position, held only by the given list
+       */
+      SharedChunk *unique_chunk(size_t chunkIndex);
+
+      /**
+       * @brief Constructs an element at the back of the list, cloning a shared back chunk or allocating a new one first
+       * @return The chunk holding the new element
+       */
+      template<typename... Args>
+      SharedChunk *construct_back(Args &&...args);
+
+    public:
+      /**
+       * @brief A random access iterator over the elements by index, cloning a shared chunk when a mutable iterator
+       * is dereferenced
+       * @tparam Mutable Whether the element referenced by the iterator can be mutated
+       */
+      template<bool Mutable>
+      using generic_iterator = IndexIterator<CowChunkedList, Mutable>;
+
+      using value_type = T;
+      using iterator = generic_iterator<true>;
+      using const_iterator = generic_iterator<false>;
+
+      static constexpr size_t chunk_size = ChunkSize;
+
+      CowChunkedList() = default;
+
+      CowChunkedList(std::initializer_list<T> initializerList);
+
+      /**
+       * @brief Shares every chunk of the other list, in O(chunks) without copying any element, except for the chunks
+       * which have handed out a mutable reference, which are cloned
+       */
+      CowChunkedList(const CowChunkedList &other);
+
+      CowChunkedList(CowChunkedList &&other) noexcept;
+
+      CowChunkedList &operator=(const CowChunkedList &other);
+
+      CowChunkedList &operator=(CowChunkedList &&other) noexcept;
+
+      ~CowChunkedList();
+
+      /**
+       * @return A copy of the list sharing every chunk it can, which later mutations of either list leave unaffected,
+       * including writes through references taken before the snapshot
+       */
+      CowChunkedList snapshot() const;
+
+      /**
+       * @brief Accesses an element by index, cloning its chunk first when the chunk is shared. The chunk is cloned
+       * rather than shared by later copies
+       */
+      T &operator[](size_t index);
+
+      const T &operator[](size_t index) const;
+
+      void push_back(const T &value);
+
+      void push_back(T &&value);
+
+      /**
+       * @brief Constructs an element at the back of the list. The chunk holding it is cloned rather than shared by
+       * later copies, as the returned reference can write to it
+       */
+      template<typename... Args>
+      T &emplace_back(Args &&...args);
+
+      void pop_back();
+
+      void clear();
+
+      iterator begin();
+
+      const_iterator begin() const;
+
+      const_iterator cbegin() const;
+
+      iterator end();
+
+      const_iterator end() const;
+
+      const_iterator cend() const;
+
+      size_t size() const;
+
+      bool empty() const;
+
+      /**
+       * @return The number of chunks held by the list which are also held by another list
+       */
+      size_t shared_chunks() const;
+
+      bool operator==(const CowChunkedList &other) const;
+  };
+} // namespace chunked_list
+
+#include "detail/CowChunkedList.tpp"
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <bit>
+#include <vector>
+
+#include "ChunkedList.hpp"
+#include "detail/IndexIterator.hpp"
+
+namespace chunked_list {
+  /**
+   * @class GeometricChunkedList
+   * @brief A chunked list whose chunks double in capacity from one to the next until reaching a cap, so a small list
+   * wastes little memory on free slots while a large one needs few allocations and few chunks to follow.
+   *
+   * The chunk at ordinal k holds FirstChunkSize << k elements until that reaches MaxChunkSize, and every later chunk
+   * holds MaxChunkSize elements. Since every chunk but the back one is full and both sizes are powers of two, the
+   * chunk holding an element and its position within it follow from the index with a few shifts and a bit width, so
+   * indexing takes constant time.
+   *
+   * @tparam T The type of elements to be stored
+   * @tparam FirstChunkSize The number of elements in the first chunk, which must be a power of two
+   * @tparam MaxChunkSize The number of elements at which chunks stop growing, which must be a power of two no smaller
+   * than FirstChunkSize
+   * @tparam Allocator The allocator used for the allocation and deallocation of the elements of each chunk
+   */
+  template<typename T, size_t FirstChunkSize = 8, size_t MaxChunkSize = 4096,
+           template<typename> typename Allocator = std::allocator>
+  class GeometricChunkedList {
+      static_assert(std::has_single_bit(FirstChunkSize), "First Chunk Size must be a power of 2");
+      static_assert(std::has_single_bit(MaxChunkSize), "Max Chunk Size must be a power of 2");
+      static_assert(FirstChunkSize <= MaxChunkSize, "Max Chunk Size must be at least First Chunk Size");
+
+      using ValueAllocator = Allocator<T>;
+      using ValueAllocatorTraits = std::allocator_traits<ValueAllocator>;
+
+      /**
+       * @brief The number of chunks which are smaller than MaxChunkSize
+       */
+      static constexpr size_t growing_chunks = std::countr_zero(MaxChunkSize / FirstChunkSize);
+
+      /**
+       * @brief The number of elements held by the chunks which are smaller than MaxChunkSize
+       */
+      static constexpr size_t growing_elements = MaxChunkSize - FirstChunkSize;
+
+      /**
+       * @brief The ordinal of the chunk holding an element and the index of the element within it
+       */
+      struct Position {
+          size_t chunk;
+          size_t offset;
+      };
+
+      [[no_unique_address]] ValueAllocator value_allocator{};
+      std::vector<T *> chunks;
+      size_t element_count{0};
+
+      static Position locate(size_t index);
+
+      /**
+       * @brief Destroys every element and deallocates every chunk, leaving the list empty
+       */
+      void release();
+
+    public:
+      /**
+       * @brief A random access iterator over the elements by index, each located from its index in constant time
+       * @tparam Mutable Whether the element referenced by the iterator can be mutated
+       */
+      template<bool Mutable>
+      using generic_iterator = IndexIterator<GeometricChunkedList, Mutable>;
+
+      using value_type = T;
+      using iterator = generic_iterator<true>;
+      using const_iterator = generic_iterator<false>;
+
+      static constexpr size_t first_chunk_size = FirstChunkSize;
+      static constexpr size_t max_chunk_size = MaxChunkSize;
+
+      GeometricChunkedList() = default;
+
+      GeometricChunkedList(std::initializer_list<T> initializerList);
+
+      GeometricChunkedList(const GeometricChunkedList &other);
+
+      GeometricChunkedList(GeometricChunkedList &&other) noexcept;
+
+      GeometricChunkedList &operator=(const GeometricChunkedList &other);
+
+      GeometricChunkedList &operator=(GeometricChunkedList &&other) noexcept;
+
+      ~GeometricChunkedList();
+
+      /**
+       * @return The number of elements held by the chunk at the given ordinal once it is full
+       */
+      static constexpr size_t chunk_capacity(size_t ordinal);
+
+      /**
+       * @brief Accesses an element by index in constant time, finding its chunk from the index alone
+       */
+      T &operator[](size_t index);
+
+      const T &operator[](size_t index) const;
+
+      void push_back(const T &value);
+
+      void push_back(T &&value);
+
+      /**
+       * @brief Constructs an element at the back of the list, allocating a chunk of the next capacity when the back
+       * chunk is full
+       */
+      template<typename... Args>
+      T &emplace_back(Args &&...args);
+
+      /**
+       * @brief Removes the last element, deallocating the back chunk once it is empty
+       */
+      void pop_back();
+
+      void clear();
+
+      iterator begin();
+
+      const_iterator begin() const;
+
+      const_iterator cbegin() const;
+
+      iterator end();
+
+      const_iterator end() const;
+
+      const_iterator cend() const;
+
+      /**
+       * @brief Calls a function with the elements of each chunk, from front to back
+       * @tparam Function A callable taking a pointer to the first element of a segment and the number of elements in it
+       * @param function The function called with each segment of the list
+       */
+      template<typename Function>
+      void for_each_segment(Function function) const;
+
+      size_t size() const;
+
+      bool empty() const;
+
+      /**
+       * @return The number of elements the allocated chunks can hold
+       */
+      size_t capacity() const;
+
+      /**
+       * @return The number of chunks, the bytes occupied by elements and the bytes allocated for chunks
+       */
+      MemoryUsage memory_usage() const;
+
+      bool operator==(const GeometricChunkedList &other) const;
+  };
+} // namespace chunked_list
+
+#include "detail/GeometricChunkedList.tpp"
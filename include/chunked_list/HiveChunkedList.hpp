@@ -0,0 +1,204 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+
+#include "ChunkedList.hpp"
+
+namespace chunked_list {
+  /**
+   * @class HiveChunkedList
+   * @brief A chunked list whose elements never move once inserted, so pointers and iterators to them stay valid until
+   * the element itself is erased, in the manner of a colony or hive.
+   *
+   * Each chunk keeps a skipfield of which slots hold elements, as a bitmap. Erasing an element destroys it and clears
+   * its bit in O(1), and a chunk left empty is returned to the allocator at once. Iteration moves from one element to
+   * the next with a bit scan, skipping up to 64 erased slots per step. Chunks with vacant slots are kept in a list of
+   * their own, most recently vacated first, so inserting reuses erased slots before allocating a chunk. Elements are
+   * therefore unordered: iteration visits them by chunk and slot, not by when they were inserted.
+   *
+   * @tparam T The type of elements to be stored
+   * @tparam ChunkSize The number of slots in each chunk
+   * @tparam Allocator The allocator used for the allocation and deallocation of chunks
+   */
+  template<typename T, size_t ChunkSize = 64, template<typename> typename Allocator = std::allocator>
+  class HiveChunkedList {
+      static_assert(ChunkSize > 0, "Chunk Size must be greater than 0");
+
+      static constexpr size_t skipfield_words = (ChunkSize + 63) / 64;
+
+      struct HiveChunk {
+          alignas(T) std::byte storage[sizeof(T) * ChunkSize];
+
+          /**
+           * @brief The skipfield of the chunk, with a set bit for each slot holding an element
+           */
+          std::array<std::uint64_t, skipfield_words> occupied{};
+
+          size_t count{0};
+          HiveChunk *prevChunk{nullptr};
+          HiveChunk *nextChunk{nullptr};
+          HiveChunk *prevVacant{nullptr};
+          HiveChunk *nextVacant{nullptr};
+
+          T *data();
+
+          const T *data() const;
+
+          /**
+           * @return The first slot from the given one onwards which holds an element, or ChunkSize if there is none
+           */
+          size_t next_occupied(size_t slot) const;
+
+          /**
+           * @return The first slot which holds no element, which must exist
+           */
+          size_t first_vacant() const;
+      };
+
+      using ChunkAllocator = Allocator<HiveChunk>;
+      using ChunkAllocatorTraits = std::allocator_traits<ChunkAllocator>;
+
+      [[no_unique_address]] ChunkAllocator chunk_allocator{};
+      HiveChunk *front_chunk{nullptr};
+      HiveChunk *back_chunk{nullptr};
+
+      /**
+       * @brief The first of the chunks with vacant slots, which inserting fills before allocating another chunk
+       */
+      HiveChunk *vacant_chunks{nullptr};
+
+      size_t chunk_count{0};
+      size_t element_count{0};
+
+      void link_vacant(HiveChunk *chunk);
+
+      void unlink_vacant(HiveChunk *chunk);
+
+      /**
+       * @brief Unlinks an empty chunk from both lists and deallocates it
+       */
+      void deallocate_chunk(HiveChunk *chunk);
+
+    public:
+      /**
+       * @brief A forward iterator over the elements, from chunk to chunk and from slot to slot
+       * @tparam Mutable Whether the element referenced by the iterator can be mutated
+       */
+      template<bool Mutable>
+      class generic_iterator {
+          friend class HiveChunkedList;
+
+          using ChunkT = std::conditional_t<Mutable, HiveChunk, const HiveChunk>;
+          using ValueT = std::conditional_t<Mutable, T, const T>;
+
+          ChunkT *chunk{nullptr};
+          size_t slot{0};
+
+          generic_iterator(ChunkT *chunk, size_t slot);
+
+        public:
+          using value_type = T;
+          using reference = ValueT &;
+          using pointer = ValueT *;
+          using difference_type = std::ptrdiff_t;
+          using iterator_category = std::forward_iterator_tag;
+          using iterator_concept = std::forward_iterator_tag;
+
+          generic_iterator() = default;
+
+          /**
+           * @brief Converts a mutable iterator into an immutable one
+           */
+          operator generic_iterator<false>() const
+            requires Mutable;
+
+          ValueT &operator*() const;
+
+          ValueT *operator->() const;
+
+          generic_iterator &operator++();
+
+          generic_iterator operator++(int);
+
+          bool operator==(const generic_iterator &other) const;
+      };
+
+      using value_type = T;
+      using iterator = generic_iterator<true>;
+      using const_iterator = generic_iterator<false>;
+
+      static constexpr size_t chunk_size = ChunkSize;
+
+      HiveChunkedList() = default;
+
+      HiveChunkedList(std::initializer_list<T> initializerList);
+
+      /**
+       * @brief Copies every element of the other list, packing them into as few chunks as they fit in
+       */
+      HiveChunkedList(const HiveChunkedList &other);
+
+      HiveChunkedList(HiveChunkedList &&other) noexcept;
+
+      HiveChunkedList &operator=(const HiveChunkedList &other);
+
+      HiveChunkedList &operator=(HiveChunkedList &&other) noexcept;
+
+      ~HiveChunkedList();
+
+      iterator insert(const T &value);
+
+      iterator insert(T &&value);
+
+      /**
+       * @brief Constructs an element in the first vacant slot of the most recently vacated chunk, or in a new chunk
+       * when no chunk has a vacant slot
+       * @return An iterator referencing the element
+       */
+      template<typename... Args>
+        requires utility::can_construct<T, Args...>
+      iterator emplace(Args &&...args);
+
+      /**
+       * @brief Destroys an element and marks its slot as vacant in O(1), leaving every other element in place, and
+       * deallocates its chunk when the chunk is left empty
+       * @return An iterator referencing the element after the one erased
+       */
+      iterator erase(const_iterator it);
+
+      /**
+       * @brief Finds the iterator referencing an element from a pointer to it, walking the chunks to find the one
+       * holding it
+       */
+      iterator get_iterator(const T *pointer);
+
+      const_iterator get_iterator(const T *pointer) const;
+
+      void clear();
+
+      iterator begin();
+
+      const_iterator begin() const;
+
+      const_iterator cbegin() const;
+
+      iterator end();
+
+      const_iterator end() const;
+
+      const_iterator cend() const;
+
+      size_t size() const;
+
+      bool empty() const;
+
+      /**
+       * @return The number of chunks, the bytes occupied by elements and the bytes allocated for chunks
+       */
+      MemoryUsage memory_usage() const;
+  };
+} // namespace chunked_list
+
+#include "detail/HiveChunkedList.tpp"
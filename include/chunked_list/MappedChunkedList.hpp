@@ -0,0 +1,230 @@
+#pragma once
+
+#include <string>
+
+#include "ChunkedList.hpp"
+
+#if !CHUNKED_LIST_POSIX
+#error "MappedChunkedList requires a POSIX system providing mmap and ftruncate"
+#endif
+
+namespace chunked_list {
+  /**
+   * @brief Whether a mapped chunked list file may be modified
+   */
+  enum class MappedAccess {
+    ReadWrite,
+    ReadOnly,
+  };
+
+  /**
+   * @class MappedArena
+   * @brief A memory-mapped file handing out fixed-size blocks, growing the file with ftruncate when it is exhausted.
+   *
+   * The whole reservation of address space is made up front, so growing the file never moves blocks which have already
+   * been handed out.
+   */
+  class MappedArena {
+    public:
+      /**
+       * @brief The header stored at the start of every mapped file
+       */
+      struct Header {
+          char magic[4]{'C', 'K', 'L', 'M'};
+          std::uint32_t version{2};
+          std::uint64_t value_size{0};
+          std::uint64_t chunk_size{0};
+          std::uint64_t block_size{0};
+          std::uint64_t root_offset{0};
+          std::uint64_t used{0};
+          std::uint64_t free_head{0};
+          std::uint64_t base{0};
+      };
+
+      /**
+       * @brief Opens or creates a mapped file
+       * @param path The path of the file which will be mapped
+       * @param access Whether the file may be modified
+       * @param reservation The number of bytes of address space reserved for the mapping, bounding the file size
+       */
+      MappedArena(const std::string &path, MappedAccess access, size_t reservation);
+
+      MappedArena(const MappedArena &) = delete;
+
+      MappedArena &operator=(const MappedArena &) = delete;
+
+      /**
+       * @brief Unmaps the file and closes it, without destroying anything stored within it
+       */
+      ~MappedArena();
+
+      /**
+       * @return Whether the file was created by the constructor rather than reopened
+       */
+      bool created() const;
+
+      /**
+       * @return Whether the file may be modified
+       */
+      bool writable() const;
+
+      /**
+       * @return The address the file was last mapped at, before this mapping
+       */
+      std::byte *previous_base() const;
+
+      std::byte *base() const;
+
+      Header &header();
+
+      const Header &header() const;
+
+      /**
+       * @brief Reserves the bytes for the root object and fixes the block size; only called on newly created files
+       * @param rootSize The size of the root object stored after the header
+       * @param rootAlignment The alignment of the root object stored after the header
+       * @param blockSize The size of each block handed out by allocate_block
+       * @param blockAlignment The alignment of each block handed out by allocate_block
+       * @return A pointer to the uninitialized storage of the root object
+       */
+      void *initialize(size_t rootSize, size_t rootAlignment, size_t blockSize, size_t blockAlignment);
+
+      /**
+       * @return A pointer to the root object stored after the header
+       */
+      void *root() const;
+
+      /**
+       * @return A block of the block size, reused from the free list when possible
+       */
+      void *allocate_block();
+
+      /**
+       * @brief Pushes a block to the free list of the file
+       */
+      void deallocate_block(void *block);
+
+      /**
+       * @brief Flushes the mapped pages to the file
+       */
+      void sync() const;
+
+      /**
+       * @return The number of bytes of the file which are currently mapped
+       */
+      size_t mapped_size() const;
+
+    private:
+      int fd{-1};
+      bool isWritable;
+      bool wasCreated{false};
+      std::byte *mapping{nullptr};
+      std::byte *previousBase{nullptr};
+      size_t reserved;
+      size_t mapped{0};
+
+      void grow(size_t minimumSize);
+  };
+
+  /**
+   * @brief A stateful allocator handing out blocks of a mapped arena. Default constructed allocators have no arena
+   * and can not allocate, which is only the case for the value allocator each chunk holds
+   * @tparam T The type of object which will be allocated
+   */
+  template<typename T>
+  class MappedAllocator {
+      template<typename>
+      friend class MappedAllocator;
+
+      MappedArena *arena{nullptr};
+
+    public:
+      using value_type = T;
+
+      MappedAllocator() = default;
+
+      explicit MappedAllocator(MappedArena &arena);
+
+      template<typename U>
+      MappedAllocator(const MappedAllocator<U> &other);
+
+      T *allocate(size_t n);
+
+      void deallocate(T *ptr, size_t n);
+
+      template<typename U>
+      bool operator==(const MappedAllocator<U> &other) const;
+  };
+
+  /**
+   * @class MappedChunkedList
+   * @brief A chunked list whose chunks, and the list itself, live in a memory-mapped file.
+   *
+   * Reopening the file restores the chunk chain, relocating the chunk pointers when the file can't be mapped at the
+   * address it was last mapped at. Opening a file read-only maps it privately, so unmodified chunks are shared through
+   * the page cache with every other process mapping the file.
+   *
+   * @tparam T The type of elements to be stored, which must be trivially copyable
+   * @tparam ChunkSize The number of elements in each chunk, with a default value of 32
+   */
+  template<typename T, size_t ChunkSize = 32>
+  class MappedChunkedList {
+      static_assert(std::is_trivially_copyable_v<T>, "Mapped elements must be trivially copyable");
+
+    public:
+      using list_type = ChunkedList<T, ChunkSize, MappedAllocator>;
+
+      static constexpr size_t default_reservation = sizeof(void *) >= 8 ? size_t{1} << 36 : size_t{1} << 30;
+
+      /**
+       * @brief Opens the mapped chunked list stored in a file, creating an empty one if the file is empty or missing
+       * @param path The path of the file which will be mapped
+       * @param access Whether the file may be modified; allocating chunks in a read-only list throws
+       * @param reservation The number of bytes of address space reserved for the mapping, bounding the file size
+       */
+      explicit MappedChunkedList(const std::string &path, MappedAccess access = MappedAccess::ReadWrite,
+                                 size_t reservation = default_reservation);
+
+      MappedChunkedList(const MappedChunkedList &) = delete;
+
+      MappedChunkedList &operator=(const MappedChunkedList &) = delete;
+
+      /**
+       * @brief Unmaps the file, leaving the list and its chunks stored within it
+       */
+      ~MappedChunkedList();
+
+      list_type &operator*();
+
+      const list_type &operator*() const;
+
+      list_type *operator->();
+
+      const list_type *operator->() const;
+
+      list_type &list();
+
+      const list_type &list() const;
+
+      /**
+       * @brief Flushes the mapped pages to the file
+       */
+      void sync() const;
+
+      /**
+       * @return The number of bytes of the file which are currently mapped
+       */
+      size_t mapped_size() const;
+
+    private:
+      using Chunk = typename list_type::Chunk;
+
+      MappedArena arena;
+
+      list_type *listPtr{nullptr};
+
+      void relocate(std::ptrdiff_t offset);
+  };
+} // namespace chunked_list
+
+#include "detail/MappedChunkedList.tpp"
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "ChunkedList.hpp"
+
+#if !CHUNKED_LIST_POSIX
+#error "PageAllocator requires a POSIX system providing mmap"
+#endif
+
+namespace chunked_list {
+  /**
+   * @class PageArena
+   * @brief Hands out fixed-size blocks packed into page-aligned regions obtained with mmap, so consecutively allocated
+   * chunks share pages, and with huge pages share a single TLB entry.
+   *
+   * Freed blocks are reused before new ones are carved out of a region. Regions are kept until the arena is destroyed,
+   * and are advised to be backed by transparent huge pages when requested; without support for them, the regions are
+   * backed by ordinary pages.
+   */
+  class PageArena {
+    public:
+      /**
+       * @brief The size and alignment of each region when huge pages are requested, being the size of a huge page
+       */
+      static constexpr size_t huge_page_size = size_t{1} << 21;
+
+      /**
+       * @param objectSize The size of the objects stored in the blocks, which are at least large enough for a pointer
+       * @param objectAlignment The alignment of the objects stored in the blocks
+       * @param hugePages Whether regions are aligned to and advised to be backed by huge pages
+       */
+      PageArena(size_t objectSize, size_t objectAlignment, bool hugePages);
+
+      PageArena(const PageArena &) = delete;
+
+      PageArena &operator=(const PageArena &) = delete;
+
+      /**
+       * @brief Unmaps every region, which must no longer hold any blocks in use
+       */
+      ~PageArena();
+
+      /**
+       * @return A block of the block size, reused from the free list when possible
+       */
+      void *allocate_block();
+
+      /**
+       * @brief Pushes a block to the free list of the arena
+       */
+      void deallocate_block(void *block);
+
+      /**
+       * @return The size of each block handed out by allocate_block
+       */
+      size_t block_size() const;
+
+      /**
+       * @return The number of bytes mapped for the regions of the arena
+       */
+      size_t mapped_size() const;
+
+      /**
+       * @return Whether the kernel accepted the advice to back every region with huge pages, which is false when huge
+       * pages weren't requested
+       */
+      bool huge_pages() const;
+
+      /**
+       * @brief Maps a page-aligned region outside the arena, for allocations which don't fit a single block
+       */
+      static void *map(size_t size, bool hugePages);
+
+      static void unmap(void *region, size_t size);
+
+    private:
+      mutable std::mutex mutex;
+      size_t blockSize;
+      size_t regionSize;
+      bool wantsHugePages;
+      bool hasHugePages;
+      std::vector<std::byte *> regions;
+      std::byte *bump{nullptr};
+      std::byte *bumpEnd{nullptr};
+      void *freeHead{nullptr};
+
+      void grow();
+  };
+
+  /**
+   * @brief A stateless allocator handing out single objects from a page arena shared by every allocator of the same
+   * type, and larger allocations from regions of their own
+   * @tparam T The type of object which will be allocated
+   * @tparam HugePages Whether regions are advised to be backed by transparent huge pages
+   */
+  template<typename T, bool HugePages>
+  class BasicPageAllocator {
+    public:
+      using value_type = T;
+      using is_always_equal = std::true_type;
+
+      template<typename U>
+      struct rebind {
+          using other = BasicPageAllocator<U, HugePages>;
+      };
+
+      BasicPageAllocator() = default;
+
+      template<typename U>
+      BasicPageAllocator(const BasicPageAllocator<U, HugePages> &);
+
+      T *allocate(size_t n);
+
+      void deallocate(T *ptr, size_t n);
+
+      /**
+       * @return The arena shared by every allocator of this type, which lives until the end of the program so chunked
+       * lists with static storage duration can outlive it
+       */
+      static PageArena &arena();
+
+      template<typename U>
+      bool operator==(const BasicPageAllocator<U, HugePages> &) const;
+  };
+
+  /**
+   * @brief An allocator handing out chunks packed into page-aligned regions
+   */
+  template<typename T>
+  using PageAllocator = BasicPageAllocator<T, false>;
+
+  /**
+   * @brief An allocator handing out chunks packed into regions backed by transparent huge pages where available,
+   * falling back to ordinary pages otherwise
+   */
+  template<typename T>
+  using HugePageAllocator = BasicPageAllocator<T, true>;
+} // namespace chunked_list
+
+#include "detail/PageAllocator.tpp"
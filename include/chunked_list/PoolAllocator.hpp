@@ -0,0 +1,132 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "ChunkedList.hpp"
+
+namespace chunked_list {
+  /**
+   * @class ChunkPool
+   * @brief Free lists of blocks of one size and alignment, shared by every allocator handing out such blocks.
+   *
+   * Each thread keeps its own free list, so allocating and freeing a block is a pointer pop or push in the common case.
+   * When a thread caches more than local_capacity blocks, half of them move to a global overflow pool, where blocks
+   * freed on one thread can be reused by another; beyond global_capacity they are returned to operator delete. A thread
+   * which runs out of blocks refills from the overflow pool before falling back to operator new.
+   *
+   * @tparam Size The size of each block
+   * @tparam Alignment The alignment of each block
+   */
+  template<size_t Size, size_t Alignment>
+  class ChunkPool {
+      static constexpr size_t block_size = Size < sizeof(void *) ? sizeof(void *) : Size;
+      static constexpr size_t block_alignment = Alignment < alignof(void *) ? alignof(void *) : Alignment;
+
+      /**
+       * @brief The free list of a thread, which is trivially destructible so it outlives every thread local list
+       */
+      struct LocalCache {
+          void *head;
+          size_t count;
+          bool flushed;
+      };
+
+      /**
+       * @brief Flushes the free list of a thread to the overflow pool when the thread exits
+       */
+      struct Flusher {
+          ~Flusher();
+      };
+
+      struct Overflow {
+          std::mutex mutex;
+          void *head{nullptr};
+
+          /**
+           * @brief The number of blocks in the pool, written under the mutex and read without it, so a thread finding
+           * the pool empty doesn't lock it
+           */
+          std::atomic<size_t> count{0};
+      };
+
+      static inline thread_local LocalCache cache{};
+
+      static Overflow &overflow();
+
+      /**
+       * @brief Registers the flusher of the calling thread, the first time its free list is used
+       */
+      static void flush_on_exit();
+
+      /**
+       * @brief Moves up to count blocks from the free list of the thread to the overflow pool, releasing the blocks
+       * which don't fit in it
+       */
+      static void spill(size_t count);
+
+      /**
+       * @brief Moves up to count blocks from the overflow pool to the free list of the thread, without locking the
+       * pool when it is empty
+       */
+      static void refill(size_t count);
+
+      static void release(void *block);
+
+    public:
+      /**
+       * @brief The maximum number of blocks cached by each thread
+       */
+      static constexpr size_t local_capacity = 256;
+
+      /**
+       * @brief The maximum number of blocks held by the overflow pool
+       */
+      static constexpr size_t global_capacity = 4096;
+
+      static void *allocate();
+
+      static void deallocate(void *block);
+
+      /**
+       * @return The number of blocks cached by the calling thread
+       */
+      static size_t cached();
+
+      /**
+       * @return The number of blocks held by the overflow pool
+       */
+      static size_t overflowed();
+  };
+
+  /**
+   * @brief A stateless allocator handing out single objects from the chunk pool of their size and alignment, and
+   * larger allocations from operator new
+   * @tparam T The type of object which will be allocated
+   */
+  template<typename T>
+  class PoolAllocator {
+    public:
+      using value_type = T;
+      using is_always_equal = std::true_type;
+
+      /**
+       * @brief The pool single objects are allocated from
+       */
+      using pool_type = ChunkPool<sizeof(T), alignof(T)>;
+
+      PoolAllocator() = default;
+
+      template<typename U>
+      PoolAllocator(const PoolAllocator<U> &);
+
+      T *allocate(size_t n);
+
+      void deallocate(T *ptr, size_t n);
+
+      template<typename U>
+      bool operator==(const PoolAllocator<U> &) const;
+  };
+} // namespace chunked_list
+
+#include "detail/PoolAllocator.tpp"
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <iterator>
+
+#include "ChunkedList.hpp"
+
+namespace chunked_list {
+  /**
+   * @class SmallChunkedList
+   * @brief A chunked list whose first few elements are stored within the object itself, for lists which usually hold
+   * only a handful of elements and so would otherwise allocate a whole chunk for them.
+   *
+   * The first InlineCapacity elements live in an inline buffer, and only the elements beyond them spill into the heap
+   * chunks of a chunked list, so a list which never outgrows the buffer never allocates. Popping elements empties the
+   * heap chunks before the inline buffer.
+   *
+   * @tparam T The type of elements to be stored
+   * @tparam InlineCapacity The number of elements stored within the object before any chunk is allocated
+   * @tparam ChunkSize The number of elements in each heap chunk
+   * @tparam Allocator The allocator used for the allocation and deallocation of heap chunks
+   */
+  template<typename T, size_t InlineCapacity = 8, size_t ChunkSize = 32,
+           template<typename> typename Allocator = std::allocator>
+  class SmallChunkedList {
+      static_assert(InlineCapacity > 0, "Inline Capacity must be greater than 0");
+
+      using ChunkedListT = ChunkedList<T, ChunkSize, Allocator>;
+
+      alignas(T) std::byte storage[sizeof(T) * InlineCapacity];
+      size_t inline_count{0};
+      ChunkedListT spill;
+
+      T *inline_data();
+
+      const T *inline_data() const;
+
+      /**
+       * @brief Destroys every inline element, leaving the heap chunks untouched
+       */
+      void clear_inline();
+
+    public:
+      /**
+       * @brief A bidirectional iterator over the inline elements and then the heap chunks, following the chunks
+       * through an iterator of the spilled chunked list
+       * @tparam Mutable Whether the element referenced by the iterator can be mutated
+       */
+      template<bool Mutable>
+      class generic_iterator {
+          friend class SmallChunkedList;
+
+          using ListT = std::conditional_t<Mutable, SmallChunkedList, const SmallChunkedList>;
+          using ValueT = std::conditional_t<Mutable, T, const T>;
+          using SpillIteratorT =
+            std::conditional_t<Mutable, typename ChunkedListT::iterator, typename ChunkedListT::const_iterator>;
+
+          ListT *list{nullptr};
+          size_t index{0};
+
+          /**
+           * @brief References the element at index - InlineCapacity in the heap chunks, or their first element while
+           * the iterator references an inline element
+           */
+          SpillIteratorT spilled{};
+
+          generic_iterator(ListT *list, size_t index, SpillIteratorT spilled);
+
+        public:
+          using value_type = T;
+          using reference = ValueT &;
+          using pointer = ValueT *;
+          using difference_type = std::ptrdiff_t;
+          using iterator_category = std::bidirectional_iterator_tag;
+          using iterator_concept = std::bidirectional_iterator_tag;
+
+          generic_iterator() = default;
+
+          ValueT &operator*() const;
+
+          ValueT *operator->() const;
+
+          generic_iterator &operator++();
+
+          generic_iterator operator++(int);
+
+          generic_iterator &operator--();
+
+          generic_iterator operator--(int);
+
+          bool operator==(const generic_iterator &other) const;
+      };
+
+      using value_type = T;
+      using iterator = generic_iterator<true>;
+      using const_iterator = generic_iterator<false>;
+
+      static constexpr size_t inline_capacity = InlineCapacity;
+      static constexpr size_t chunk_size = ChunkSize;
+
+      SmallChunkedList() = default;
+
+      SmallChunkedList(std::initializer_list<T> initializerList);
+
+      SmallChunkedList(const SmallChunkedList &other);
+
+      /**
+       * @brief Moves the inline elements one by one and takes the heap chunks of the other list, which is left empty
+       */
+      SmallChunkedList(SmallChunkedList &&other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+      SmallChunkedList &operator=(const SmallChunkedList &other);
+
+      SmallChunkedList &operator=(SmallChunkedList &&other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+      ~SmallChunkedList();
+
+      /**
+       * @brief Accesses an element by index, walking the heap chunks only for elements beyond the inline ones
+       */
+      T &operator[](size_t index);
+
+      const T &operator[](size_t index) const;
+
+      void push_back(const T &value);
+
+      void push_back(T &&value);
+
+      /**
+       * @brief Constructs an element in the inline buffer, or at the back of the heap chunks once the buffer is full
+       */
+      template<typename... Args>
+        requires utility::can_construct<T, Args...>
+      void emplace_back(Args &&...args);
+
+      /**
+       * @brief Removes the last element, from the heap chunks while any are left and from the inline buffer otherwise
+       */
+      void pop_back();
+
+      void clear();
+
+      iterator begin();
+
+      const_iterator begin() const;
+
+      const_iterator cbegin() const;
+
+      iterator end();
+
+      const_iterator end() const;
+
+      const_iterator cend() const;
+
+      /**
+       * @brief Calls a function with the inline elements and then with the data block of each heap chunk, from front
+       * to back
+       * @tparam Function A callable taking a pointer to the first element of a segment and the number of elements in it
+       * @param function The function called with each segment of the list
+       */
+      template<typename Function>
+      void for_each_segment(Function function) const;
+
+      size_t size() const;
+
+      bool empty() const;
+
+      /**
+       * @return Whether the list has outgrown its inline buffer, holding elements in heap chunks too
+       */
+      bool spilled() const;
+
+      bool operator==(const SmallChunkedList &other) const;
+  };
+} // namespace chunked_list
+
+#include "detail/SmallChunkedList.tpp"
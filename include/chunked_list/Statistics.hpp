@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace chunked_list {
+  /**
+   * @brief Opts a chunked list type into collecting statistics, by specializing it to true before the type is first
+   * used. Chunked lists which aren't opted in don't record anything, so collecting statistics costs nothing unless
+   * it is enabled
+   * @tparam ChunkedListType The type of chunked list
+   */
+  template<typename ChunkedListType>
+  inline constexpr bool enable_statistics = false;
+
+  /**
+   * @brief Counters shared by every chunked list of a type opted into statistics with enable_statistics. The counters
+   * are updated with relaxed atomic increments, so lists of the same type may be used by several threads
+   */
+  struct Statistics {
+      /**
+       * @brief The number of chunks allocated
+       */
+      std::atomic<size_t> chunk_allocations{0};
+
+      /**
+       * @brief The number of chunks deallocated
+       */
+      std::atomic<size_t> chunk_deallocations{0};
+
+      /**
+       * @brief The number of linear walks over the chunk chain made by indexing, slicing and iterator arithmetic
+       */
+      std::atomic<size_t> chunk_walks{0};
+
+      /**
+       * @brief The total number of chunks stepped over by every chunk walk
+       */
+      std::atomic<size_t> chunks_walked{0};
+
+      /**
+       * @brief The number of elements moved to a different position by erasing, splitting and sorting
+       */
+      std::atomic<size_t> elements_moved{0};
+
+      /**
+       * @brief Sets every counter to 0
+       */
+      void reset();
+  };
+
+  /**
+   * @brief A snapshot of the memory held by a chunked list
+   */
+  struct MemoryUsage {
+      /**
+       * @brief The number of chunks held by the chunked list
+       */
+      size_t chunks{0};
+
+      /**
+       * @brief The number of bytes occupied by elements
+       */
+      size_t used_bytes{0};
+
+      /**
+       * @brief The number of bytes allocated for chunks, including their free slots and links
+       */
+      size_t reserved_bytes{0};
+  };
+
+  namespace utility {
+    template<typename ChunkedListType>
+    inline Statistics statistics_of{};
+
+    /**
+     * @brief Adds to a statistics counter of a chunked list type, doing nothing unless the type is opted in
+     */
+    template<typename ChunkedListType>
+    void record(std::atomic<size_t> Statistics::*counter, size_t amount = 1);
+
+    /**
+     * @brief Records a linear walk over the chunk chain of a chunked list type
+     * @param chunks The number of chunks stepped over
+     */
+    template<typename ChunkedListType>
+    void record_walk(size_t chunks);
+  } // namespace utility
+} // namespace chunked_list
+
+#include "detail/Statistics.tpp"
@@ -1,25 +1,32 @@
 #pragma once
 
+#include <algorithm>
+
 #include "../ChunkedList.hpp"
 
 namespace chunked_list {
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
-  ChunkedList<T, ChunkSize, Allocator>::Chunk::Chunk(Chunk *prevChunk, Chunk *nextChunk) :
-      prevChunk{prevChunk}, nextChunk{nextChunk} {}
+  ChunkedList<T, ChunkSize, Allocator>::Chunk::Chunk(Chunk *prevChunk, Chunk *nextChunk,
+                                                     const ValueAllocator &valueAllocator) :
+      value_allocator{valueAllocator}, prevChunk{prevChunk}, nextChunk{nextChunk} {}
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   ChunkedList<T, ChunkSize, Allocator>::Chunk::Chunk(const T *pointer, const size_t size, Chunk *prevChunk,
-                                                     Chunk *nextChunk) :
-      nextIndex{size}, prevChunk{prevChunk}, nextChunk{nextChunk} {
+                                                     Chunk *nextChunk, const ValueAllocator &valueAllocator) :
+      value_allocator{valueAllocator}, nextIndex{size}, prevChunk{prevChunk}, nextChunk{nextChunk} {
     for (size_t index = 0; index < size; ++index) {
-      ValueAllocatorTraits::construct(value_allocator, data() + index, pointer[index]);
+      ValueAllocatorTraits::construct(value_allocator, raw_data() + index, pointer[index]);
     }
+
+    rebuild_zone();
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
-  ChunkedList<T, ChunkSize, Allocator>::Chunk::Chunk(T &&value, Chunk *prevChunk, Chunk *nextChunk) :
-      nextIndex{1}, prevChunk{prevChunk}, nextChunk{nextChunk} {
-    ValueAllocatorTraits::construct(value_allocator, data(), std::forward<T>(value));
+  ChunkedList<T, ChunkSize, Allocator>::Chunk::Chunk(T &&value, Chunk *prevChunk, Chunk *nextChunk,
+                                                     const ValueAllocator &valueAllocator) :
+      value_allocator{valueAllocator}, nextIndex{1}, prevChunk{prevChunk}, nextChunk{nextChunk} {
+    ValueAllocatorTraits::construct(value_allocator, raw_data(), std::forward<T>(value));
+    rebuild_zone();
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
@@ -28,10 +35,69 @@ namespace chunked_list {
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
-  T *ChunkedList<T, ChunkSize, Allocator>::Chunk::data() {
+  T *ChunkedList<T, ChunkSize, Allocator>::Chunk::raw_data() {
     return std::launder(reinterpret_cast<T *>(array));
   }
 
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::Chunk::widen_zone(const T &value) {
+    if constexpr (zoned) {
+      if (nextIndex == 0) {
+        zone = ZoneMap{value, value, true};
+      } else if (zone.current) {
+        if (value < zone.minimum) {
+          zone.minimum = value;
+        } else if (zone.maximum < value) {
+          zone.maximum = value;
+        }
+      }
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::Chunk::invalidate_zone() {
+    if constexpr (zoned) {
+      zone.current = false;
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::Chunk::rebuild_zone() {
+    if constexpr (zoned) {
+      if (nextIndex == 0) {
+        zone.current = false;
+        return;
+      }
+
+      const auto [minimum, maximum] = std::minmax_element(raw_data(), raw_data() + nextIndex);
+      zone = ZoneMap{*minimum, *maximum, true};
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  bool ChunkedList<T, ChunkSize, Allocator>::Chunk::outside_zone(const T &low, const T &high) const {
+    if constexpr (zoned) {
+      return zone.current && (zone.maximum < low || high < zone.minimum);
+    } else {
+      return false;
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  bool ChunkedList<T, ChunkSize, Allocator>::Chunk::within_zone(const T &low, const T &high) const {
+    if constexpr (zoned) {
+      return zone.current && !(zone.minimum < low) && !(high < zone.maximum);
+    } else {
+      return false;
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  T *ChunkedList<T, ChunkSize, Allocator>::Chunk::data() {
+    invalidate_zone();
+    return raw_data();
+  }
+
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   const T *ChunkedList<T, ChunkSize, Allocator>::Chunk::data() const {
     return std::launder(reinterpret_cast<const T *>(array));
@@ -39,7 +105,8 @@ namespace chunked_list {
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   void ChunkedList<T, ChunkSize, Allocator>::Chunk::push_back(T &&value) {
-    ValueAllocatorTraits::construct(value_allocator, data() + nextIndex, std::forward<T>(value));
+    ValueAllocatorTraits::construct(value_allocator, raw_data() + nextIndex, std::forward<T>(value));
+    widen_zone(raw_data()[nextIndex]);
     ++nextIndex;
   }
 
@@ -47,21 +114,26 @@ namespace chunked_list {
   template<typename... Args>
     requires utility::can_construct<T, Args...>
   void ChunkedList<T, ChunkSize, Allocator>::Chunk::emplace_back(Args &&...args) {
-    ValueAllocatorTraits::construct(value_allocator, data() + nextIndex, std::forward<Args>(args)...);
+    ValueAllocatorTraits::construct(value_allocator, raw_data() + nextIndex, std::forward<Args>(args)...);
+    widen_zone(raw_data()[nextIndex]);
     ++nextIndex;
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   void ChunkedList<T, ChunkSize, Allocator>::Chunk::pop_back() {
     --nextIndex;
-    std::destroy_at(data() + nextIndex);
+    std::destroy_at(raw_data() + nextIndex);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::Chunk::truncate(const size_t count) {
+    std::destroy(raw_data() + count, raw_data() + nextIndex);
+    nextIndex = count;
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   void ChunkedList<T, ChunkSize, Allocator>::Chunk::clear() {
-    while (nextIndex) {
-      pop_back();
-    }
+    truncate(0);
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
@@ -99,7 +171,8 @@ namespace chunked_list {
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   T &ChunkedList<T, ChunkSize, Allocator>::Chunk::operator[](const size_t index) {
-    return data()[index];
+    invalidate_zone();
+    return raw_data()[index];
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
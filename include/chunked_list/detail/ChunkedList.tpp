@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <vector>
 
 #include "../ChunkedList.hpp"
 #include "utility.hpp"
@@ -18,46 +21,419 @@ namespace chunked_list {
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
-  ChunkedList<T, ChunkSize, Allocator>::ChunkedList() : chunk_count{0} {
-    new (&sentinel) Chunk{get_sentinel(), get_sentinel()};
+  template<typename... Args>
+  typename ChunkedList<T, ChunkSize, Allocator>::Chunk *
+  ChunkedList<T, ChunkSize, Allocator>::allocate_chunk(Args &&...args) {
+    Chunk *chunkPtr = ChunkAllocatorTraits::allocate(chunk_allocator, 1);
+
+    try {
+      new (chunkPtr) Chunk{std::forward<Args>(args)..., make_value_allocator()};
+    } catch (...) {
+      ChunkAllocatorTraits::deallocate(chunk_allocator, chunkPtr, 1);
+      throw;
+    }
+
+    utility::record<ChunkedList>(&Statistics::chunk_allocations);
+    return chunkPtr;
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
-  ChunkedList<T, ChunkSize, Allocator>::ChunkedList(std::initializer_list<T> initializerList) {
-    if (initializerList.size() == 0) {
-      new (&sentinel) Chunk{get_sentinel(), get_sentinel()};
-      return;
+  template<typename... Args>
+  typename ChunkedList<T, ChunkSize, Allocator>::Chunk *
+  ChunkedList<T, ChunkSize, Allocator>::push_chunk(Args &&...args) {
+    Chunk *backPtr = get_sentinel()->prevChunk;
+    Chunk *chunkPtr = allocate_chunk(std::forward<Args>(args)..., backPtr, get_sentinel());
+
+    backPtr->nextChunk = chunkPtr;
+    get_sentinel()->prevChunk = chunkPtr;
+
+    ++chunk_count;
+    return chunkPtr;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::deallocate_chunk(Chunk *chunkPtr) {
+    std::destroy_at(chunkPtr);
+    ChunkAllocatorTraits::deallocate(chunk_allocator, chunkPtr, 1);
+
+    utility::record<ChunkedList>(&Statistics::chunk_deallocations);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Constructor>
+  void ChunkedList<T, ChunkSize, Allocator>::construct_chunks(const size_t chunks, const size_t elements,
+                                                              Constructor construct) {
+    std::vector<Chunk *> chunkPtrs;
+    chunkPtrs.reserve(chunks);
+
+    try {
+      for (size_t index = 0; index < chunks; ++index) {
+        chunkPtrs.push_back(push_chunk());
+      }
+
+      auto constructRange = [&chunkPtrs, &construct](const size_t start, const size_t end) {
+        for (size_t index = start; index < end; ++index) {
+          if (index + utility::prefetch_distance < end) {
+            prefetch_chunk(chunkPtrs[index + utility::prefetch_distance]);
+          }
+
+          construct(*chunkPtrs[index], index);
+        }
+      };
+
+      // Allocators with state, such as polymorphic allocators, may not be safe to construct elements with at once
+      if (runs_in_parallel(elements) && ChunkAllocatorTraits::is_always_equal::value) {
+        utility::parallel_for(chunks, constructRange);
+      } else {
+        constructRange(0, chunks);
+      }
+    } catch (...) {
+      clear();
+      throw;
     }
 
-    if (ChunkSize >= initializerList.size()) {
-      chunk_count = 1;
-      new (&sentinel) Chunk{initializerList.begin(), initializerList.size(), get_sentinel(), get_sentinel()};
-      return;
+    element_count = elements;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Appender>
+  void ChunkedList<T, ChunkSize, Allocator>::grow(const size_t count, Appender append) {
+    Chunk *backPtr = get_sentinel()->prevChunk;
+    const size_t vacant = backPtr == get_sentinel() ? 0 : ChunkSize - backPtr->size();
+    const size_t topUp = std::min(vacant, count - element_count);
+    const size_t remaining = count - element_count - topUp;
+
+    // The new chunks are built first, so only the elements appended to the back chunk need undoing if any throws
+    ChunkedList grown{chunk_allocator};
+    grown.construct_chunks((remaining + ChunkSize - 1) / ChunkSize, remaining,
+                           [remaining, &append](Chunk &chunk, const size_t index) {
+                             for (size_t offset = index * ChunkSize;
+                                  offset < std::min(remaining, (index + 1) * ChunkSize); ++offset) {
+                               append(chunk);
+                             }
+                           });
+
+    const size_t previousCount = element_count;
+
+    try {
+      for (size_t offset = 0; offset < topUp; ++offset) {
+        append(*backPtr);
+        ++element_count;
+      }
+    } catch (...) {
+      truncate(previousCount);
+      throw;
+    }
+
+    invalidate_fences();
+    relink_chunks(grown);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::prefetch_chunk(const Chunk *chunkPtr) {
+    if constexpr (utility::prefetch_distance > 0) {
+      if (!chunkPtr) {
+        return;
+      }
+
+      utility::prefetch(chunkPtr);
+      utility::prefetch(chunkPtr->data());
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  constexpr bool ChunkedList<T, ChunkSize, Allocator>::runs_in_parallel(const size_t elements) {
+    return enable_parallelism<ChunkedList> && elements >= utility::parallel_threshold / sizeof(T);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename ChunkT, typename Function>
+  void ChunkedList<T, ChunkSize, Allocator>::for_each_chunk(ChunkT *sentinelPtr, Function function) {
+    // The lookahead chases the links prefetched by earlier steps, so only the first few steps wait on a cold chunk
+    ChunkT *aheadPtr = sentinelPtr->nextChunk;
+
+    for (size_t step = 0; step < utility::prefetch_distance && aheadPtr != sentinelPtr; ++step) {
+      prefetch_chunk(aheadPtr);
+      aheadPtr = aheadPtr->nextChunk;
     }
 
-    chunk_count = (initializerList.size() + ChunkSize - 1) / ChunkSize;
+    for (ChunkT *chunkPtr = sentinelPtr->nextChunk; chunkPtr != sentinelPtr; chunkPtr = chunkPtr->nextChunk) {
+      if (aheadPtr != sentinelPtr) {
+        prefetch_chunk(aheadPtr);
+        aheadPtr = aheadPtr->nextChunk;
+      }
 
-    Chunk *frontPtr = ChunkAllocatorTraits::allocate(chunk_allocator, 1);
-    Chunk *backPtr = ChunkAllocatorTraits::allocate(chunk_allocator, 1);
+      function(*chunkPtr);
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::invalidate_fences() {
+    if constexpr (fenced) {
+      if (fences) {
+        fences->current = false;
+      }
+    }
+  }
 
-    new (frontPtr) Chunk{initializerList.begin(), ChunkSize, get_sentinel(), nullptr};
-    new (&sentinel) Chunk{backPtr, frontPtr};
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename ChunkT>
+  ChunkT *ChunkedList<T, ChunkSize, Allocator>::chunk_holding(ChunkT *sentinelPtr, size_t &index) {
+    ChunkT *chunk = sentinelPtr->nextChunk;
+    size_t walked = 0;
 
-    Chunk *lastChunkPtr = frontPtr;
+    for (; index >= chunk->size(); ++walked) {
+      index -= chunk->size();
+      chunk = chunk->nextChunk;
 
-    for (size_t offset = 1; offset < chunk_count - 1; ++offset) {
-      Chunk *chunkPtr = ChunkAllocatorTraits::allocate(chunk_allocator, 1);
-      new (chunkPtr) Chunk{initializerList.begin() + offset * ChunkSize, ChunkSize, lastChunkPtr};
-      lastChunkPtr->nextChunk = chunkPtr;
-      lastChunkPtr = chunkPtr;
+      // Starts loading the links of the following chunk while the size of this one is compared
+      prefetch_chunk(chunk->nextChunk);
     }
 
-    lastChunkPtr->nextChunk = backPtr;
+    utility::record_walk<ChunkedList>(walked);
+    return chunk;
+  }
 
-    const int remainingItems = initializerList.size() % ChunkSize;
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  bool ChunkedList<T, ChunkSize, Allocator>::equal_from(const Chunk *chunkPtr, size_t index,
+                                                        const Chunk *otherChunkPtr, size_t otherIndex, size_t count,
+                                                        const std::atomic<bool> &mismatch) {
+    while (count > 0) {
+      if (mismatch.load(std::memory_order_relaxed)) {
+        return false;
+      }
+
+      const size_t span = std::min({count, chunkPtr->size() - index, otherChunkPtr->size() - otherIndex});
+      const T *data = chunkPtr->data() + index;
+      const T *otherData = otherChunkPtr->data() + otherIndex;
+
+      if constexpr (utility::bytewise_comparable<T>) {
+        if (std::memcmp(data, otherData, span * sizeof(T)) != 0) {
+          return false;
+        }
+      } else if (!std::equal(data, data + span, otherData)) {
+        return false;
+      }
 
-    new (backPtr) Chunk{initializerList.begin() + (chunk_count - 1) * ChunkSize,
-                        remainingItems == 0 ? ChunkSize : remainingItems, lastChunkPtr, get_sentinel()};
+      count -= span;
+      index += span;
+      otherIndex += span;
+
+      if (index == chunkPtr->size()) {
+        chunkPtr = chunkPtr->nextChunk;
+        index = 0;
+      }
+
+      if (otherIndex == otherChunkPtr->size()) {
+        otherChunkPtr = otherChunkPtr->nextChunk;
+        otherIndex = 0;
+      }
+    }
+
+    return true;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::forget_fences() {
+    if constexpr (fenced) {
+      std::construct_at(&fences);
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::release_fences() {
+    if constexpr (fenced) {
+      fences.reset();
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Before>
+  typename ChunkedList<T, ChunkSize, Allocator>::const_iterator
+  ChunkedList<T, ChunkSize, Allocator>::find_partition_point(Before before) const {
+    if constexpr (fenced) {
+      if (fences && fences->current) {
+        const std::vector<T> &keys = fences->keys;
+        const std::vector<const Chunk *> &chunks = fences->chunks;
+
+        // The partition point lies in the chunk before the first one whose first element isn't before it, unless
+        // that chunk starts with it
+        const auto fence =
+          static_cast<size_t>(std::partition_point(keys.begin(), keys.end(), before) - keys.begin());
+
+        if (fence == 0) {
+          return chunks.empty() ? cend() : const_iterator{chunks[0], 0};
+        }
+
+        const Chunk *chunkPtr = chunks[fence - 1];
+        const T *chunkEnd = chunkPtr->data() + chunkPtr->size();
+        const T *position = std::partition_point(chunkPtr->data() + 1, chunkEnd, before);
+
+        if (position != chunkEnd) {
+          return const_iterator{chunkPtr, static_cast<size_t>(position - chunkPtr->data())};
+        }
+
+        return fence < chunks.size() ? const_iterator{chunks[fence], 0} : cend();
+      }
+    }
+
+    for (const Chunk *chunkPtr = get_sentinel()->nextChunk; chunkPtr != get_sentinel();
+         chunkPtr = chunkPtr->nextChunk) {
+      if (!chunkPtr->empty() && !before((*chunkPtr)[chunkPtr->size() - 1])) {
+        const T *position = std::partition_point(chunkPtr->data(), chunkPtr->data() + chunkPtr->size(), before);
+        return const_iterator{chunkPtr, static_cast<size_t>(position - chunkPtr->data())};
+      }
+    }
+
+    return cend();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename ChunkedList<T, ChunkSize, Allocator>::ValueAllocator
+  ChunkedList<T, ChunkSize, Allocator>::make_value_allocator() const {
+    if constexpr (std::is_constructible_v<ValueAllocator, const ChunkAllocator &>) {
+      return ValueAllocator(chunk_allocator);
+    } else {
+      return ValueAllocator{};
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::move_elements(ChunkedList &other) {
+    for (T &value : other) {
+      push_back(std::move(value));
+    }
+
+    other.clear();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  ChunkedList<T, ChunkSize, Allocator>::ChunkedList() {
+    new (&sentinel) Chunk{get_sentinel(), get_sentinel(), make_value_allocator()};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  ChunkedList<T, ChunkSize, Allocator>::ChunkedList(const Allocator<Chunk> &chunkAllocator) :
+      chunk_allocator{chunkAllocator} {
+    new (&sentinel) Chunk{get_sentinel(), get_sentinel(), make_value_allocator()};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  ChunkedList<T, ChunkSize, Allocator>::ChunkedList(std::initializer_list<T> initializerList) :
+      ChunkedList{initializerList, Allocator<Chunk>{}} {}
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  ChunkedList<T, ChunkSize, Allocator>::ChunkedList(std::initializer_list<T> initializerList,
+                                                    const Allocator<Chunk> &chunkAllocator) :
+      ChunkedList{chunkAllocator} {
+    for (size_t offset = 0; offset < initializerList.size(); offset += ChunkSize) {
+      push_chunk(initializerList.begin() + offset, std::min(ChunkSize, initializerList.size() - offset));
+    }
+
+    element_count = initializerList.size();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  ChunkedList<T, ChunkSize, Allocator>::ChunkedList(const size_t count, const T &value,
+                                                    const Allocator<Chunk> &chunkAllocator) :
+      ChunkedList{chunkAllocator} {
+    construct_chunks((count + ChunkSize - 1) / ChunkSize, count, [count, &value](Chunk &chunk, const size_t index) {
+      for (size_t offset = index * ChunkSize; offset < std::min(count, (index + 1) * ChunkSize); ++offset) {
+        chunk.emplace_back(value);
+      }
+    });
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Generator>
+    requires std::is_invocable_r_v<T, Generator &, size_t>
+  ChunkedList<T, ChunkSize, Allocator>::ChunkedList(const size_t count, Generator generator,
+                                                    const Allocator<Chunk> &chunkAllocator) :
+      ChunkedList{chunkAllocator} {
+    construct_chunks((count + ChunkSize - 1) / ChunkSize, count, [count, &generator](Chunk &chunk, const size_t index) {
+      for (size_t offset = index * ChunkSize; offset < std::min(count, (index + 1) * ChunkSize); ++offset) {
+        chunk.emplace_back(generator(offset));
+      }
+    });
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  ChunkedList<T, ChunkSize, Allocator>::ChunkedList(const ChunkedList &other) :
+      ChunkedList{other, ChunkAllocatorTraits::select_on_container_copy_construction(other.chunk_allocator)} {}
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  ChunkedList<T, ChunkSize, Allocator>::ChunkedList(const ChunkedList &other, const Allocator<Chunk> &chunkAllocator) :
+      ChunkedList{chunkAllocator} {
+    std::vector<const Chunk *> sources;
+    sources.reserve(other.chunk_count);
+    for_each_chunk(other.get_sentinel(), [&sources](const Chunk &chunk) { sources.push_back(&chunk); });
+
+    construct_chunks(sources.size(), other.element_count, [&sources](Chunk &chunk, const size_t index) {
+      for (size_t offset = 0; offset < sources[index]->size(); ++offset) {
+        chunk.emplace_back((*sources[index])[offset]);
+      }
+    });
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  ChunkedList<T, ChunkSize, Allocator>::ChunkedList(ChunkedList &&other) noexcept :
+      ChunkedList{other.chunk_allocator} {
+    relink_chunks(other);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  ChunkedList<T, ChunkSize, Allocator>::ChunkedList(ChunkedList &&other, const Allocator<Chunk> &chunkAllocator) :
+      ChunkedList{chunkAllocator} {
+    if constexpr (ChunkAllocatorTraits::is_always_equal::value) {
+      relink_chunks(other);
+    } else if (chunk_allocator == other.chunk_allocator) {
+      relink_chunks(other);
+    } else {
+      move_elements(other);
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  ChunkedList<T, ChunkSize, Allocator> &ChunkedList<T, ChunkSize, Allocator>::operator=(const ChunkedList &other) {
+    if (this == &other) {
+      return *this;
+    }
+
+    constexpr bool propagates = ChunkAllocatorTraits::propagate_on_container_copy_assignment::value;
+
+    ChunkedList copy{other, propagates ? other.chunk_allocator : chunk_allocator};
+    clear();
+
+    if constexpr (propagates) {
+      chunk_allocator = other.chunk_allocator;
+    }
+
+    relink_chunks(copy);
+    return *this;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  ChunkedList<T, ChunkSize, Allocator> &ChunkedList<T, ChunkSize, Allocator>::operator=(ChunkedList &&other) noexcept(
+    ChunkAllocatorTraits::propagate_on_container_move_assignment::value ||
+    ChunkAllocatorTraits::is_always_equal::value) {
+    if (this == &other) {
+      return *this;
+    }
+
+    clear();
+
+    if constexpr (ChunkAllocatorTraits::propagate_on_container_move_assignment::value) {
+      chunk_allocator = other.chunk_allocator;
+      relink_chunks(other);
+    } else if constexpr (ChunkAllocatorTraits::is_always_equal::value) {
+      relink_chunks(other);
+    } else if (chunk_allocator == other.chunk_allocator) {
+      relink_chunks(other);
+    } else {
+      move_elements(other);
+    }
+
+    return *this;
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
@@ -66,8 +442,7 @@ namespace chunked_list {
 
     while (currentPtr != get_sentinel()) {
       Chunk *prevPtr = currentPtr->prevChunk;
-      std::destroy_at(currentPtr);
-      ChunkAllocatorTraits::deallocate(chunk_allocator, currentPtr, 1);
+      deallocate_chunk(currentPtr);
       currentPtr = prevPtr;
     }
 
@@ -90,19 +465,14 @@ namespace chunked_list {
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
-  T &ChunkedList<T, ChunkSize, Allocator>::operator[](const size_t index) {
-    Chunk *chunk = get_sentinel()->nextChunk;
-
-    for (size_t chunkIndex = index / ChunkSize; chunkIndex > 0; --chunkIndex) {
-      chunk = chunk->nextChunk;
-    }
-
-    return (*chunk)[index % ChunkSize];
+  T &ChunkedList<T, ChunkSize, Allocator>::operator[](size_t index) {
+    invalidate_fences();
+    return (*chunk_holding(get_sentinel(), index))[index];
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
-  const T &ChunkedList<T, ChunkSize, Allocator>::operator[](const size_t index) const {
-    return const_cast<ChunkedList *>(this)->operator[](index);
+  const T &ChunkedList<T, ChunkSize, Allocator>::operator[](size_t index) const {
+    return (*chunk_holding(get_sentinel(), index))[index];
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
@@ -125,6 +495,8 @@ namespace chunked_list {
   template<typename IteratorType>
     requires utility::iterator_or_chunk_iterator<ChunkedList<T, ChunkSize, Allocator>, IteratorType>
   IteratorType ChunkedList<T, ChunkSize, Allocator>::begin() {
+    // The fences can't follow writes through the iterator, so they are dropped as it is handed out
+    invalidate_fences();
     return IteratorType{get_sentinel()->nextChunk};
   }
 
@@ -169,6 +541,7 @@ namespace chunked_list {
   template<typename IteratorType>
     requires utility::iterator_or_chunk_iterator<ChunkedList<T, ChunkSize, Allocator>, IteratorType>
   IteratorType ChunkedList<T, ChunkSize, Allocator>::end() {
+    invalidate_fences();
     return IteratorType{get_sentinel()};
   }
 
@@ -212,23 +585,8 @@ namespace chunked_list {
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   typename ChunkedList<T, ChunkSize, Allocator>::mutable_slice
   ChunkedList<T, ChunkSize, Allocator>::slice(const size_t startIndex, const size_t endIndex) {
-    chunk_iterator chunkIt{get_sentinel()->nextChunk};
-
-    const size_t startChunkIndex = startIndex / ChunkSize;
-
-    for (size_t i = 0; i < startChunkIndex; ++i) {
-      ++chunkIt;
-    }
-
-    Chunk &startChunk = *chunkIt;
-
-    const size_t endChunkIndex = endIndex / ChunkSize;
-
-    for (size_t i = startChunkIndex; i < endChunkIndex; ++i) {
-      ++chunkIt;
-    }
-
-    return mutable_slice{iterator{startChunk, startIndex % ChunkSize}, iterator{*chunkIt, endIndex % ChunkSize}};
+    iterator startIt = begin() + startIndex;
+    return mutable_slice{startIt, startIt + (endIndex - startIndex)};
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
@@ -240,7 +598,7 @@ namespace chunked_list {
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   typename ChunkedList<T, ChunkSize, Allocator>::immutable_slice
   ChunkedList<T, ChunkSize, Allocator>::cslice(const size_t startIndex, const size_t endIndex) const {
-    return slice();
+    return slice(startIndex, endIndex);
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
@@ -267,22 +625,20 @@ namespace chunked_list {
                                                        EndIteratorT>
   typename ChunkedList<T, ChunkSize, Allocator>::immutable_slice
   ChunkedList<T, ChunkSize, Allocator>::cslice(StartIteratorT start, EndIteratorT end) const {
-    return slice();
+    return slice(start, end);
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   void ChunkedList<T, ChunkSize, Allocator>::push_back(T &&value) {
-    if (Chunk *backPtr = get_sentinel()->prevChunk; backPtr->size() == ChunkSize) {
-      Chunk *chunkPtr = ChunkAllocatorTraits::allocate(chunk_allocator, 1);
-      new (chunkPtr) Chunk{std::forward<T>(value), backPtr, get_sentinel()};
-
-      backPtr->nextChunk = chunkPtr;
-      get_sentinel()->prevChunk = chunkPtr;
+    invalidate_fences();
 
-      ++chunk_count;
+    if (Chunk *backPtr = get_sentinel()->prevChunk; backPtr == get_sentinel() || backPtr->size() == ChunkSize) {
+      push_chunk(std::forward<T>(value));
     } else {
       backPtr->push_back(std::forward<T>(value));
     }
+
+    ++element_count;
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
@@ -294,83 +650,324 @@ namespace chunked_list {
   template<typename... Args>
     requires utility::can_construct<T, Args...>
   void ChunkedList<T, ChunkSize, Allocator>::emplace_back(Args &&...args) {
-    if (Chunk *backPtr = get_sentinel()->prevChunk; backPtr->size() == ChunkSize) {
-      Chunk *chunkPtr = ChunkAllocatorTraits::allocate(chunk_allocator, 1);
-      new (chunkPtr) Chunk{T{std::forward<Args>(args)}..., backPtr, sentinel};
+    invalidate_fences();
 
-      backPtr->nextChunk = chunkPtr;
-      get_sentinel()->prevChunk = chunkPtr;
+    Chunk *backPtr = get_sentinel()->prevChunk;
 
-      ++chunk_count;
-    } else {
-      backPtr->emplace_back(std::forward<Args>(args)...);
+    if (backPtr == get_sentinel() || backPtr->size() == ChunkSize) {
+      backPtr = push_chunk();
     }
+
+    backPtr->emplace_back(std::forward<Args>(args)...);
+    ++element_count;
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   void ChunkedList<T, ChunkSize, Allocator>::pop_back() {
-    if (Chunk *backPtr = get_sentinel()->prevChunk; backPtr->empty()) {
+    invalidate_fences();
+
+    Chunk *backPtr = get_sentinel()->prevChunk;
+    backPtr->pop_back();
+    --element_count;
+
+    if (backPtr->empty()) {
       pop_chunk();
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::pop_back(const size_t count) {
+    truncate(element_count - count);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::truncate(const size_t count) {
+    if (count >= element_count) {
+      return;
+    }
+
+    if (count == 0) {
+      clear();
+      return;
+    }
+
+    invalidate_fences();
+
+    size_t excess = element_count - count;
+    Chunk *backPtr = get_sentinel()->prevChunk;
+
+    // Every chunk holding only excess elements is freed without being relinked, as the new back chunk is linked to the
+    // sentinel once they are all gone
+    while (backPtr->size() <= excess) {
+      excess -= backPtr->size();
+
+      Chunk *prevPtr = backPtr->prevChunk;
+      deallocate_chunk(backPtr);
+      --chunk_count;
+      backPtr = prevPtr;
+    }
+
+    backPtr->nextChunk = get_sentinel();
+    get_sentinel()->prevChunk = backPtr;
+
+    backPtr->truncate(backPtr->size() - excess);
+    element_count = count;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::resize(const size_t count) {
+    if (count <= element_count) {
+      truncate(count);
     } else {
-      backPtr->pop_back();
+      grow(count, [](Chunk &chunk) { chunk.emplace_back(); });
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::resize(const size_t count, const T &value) {
+    if (count <= element_count) {
+      truncate(count);
+    } else {
+      grow(count, [&value](Chunk &chunk) { chunk.emplace_back(value); });
     }
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   typename ChunkedList<T, ChunkSize, Allocator>::iterator ChunkedList<T, ChunkSize, Allocator>::erase(iterator it) {
-    iterator nextIt = ++it;
-    iterator firstIt = it, secondIt = nextIt, endIt = end();
+    invalidate_fences();
+
+    Chunk &chunk = it.get_chunk();
+    const size_t index = it.get_index();
 
-    while (secondIt != endIt) {
-      *firstIt = std::move(*secondIt);
-      firstIt = secondIt;
-      ++secondIt;
+    for (size_t i = index + 1; i < chunk.size(); ++i) {
+      chunk[i - 1] = std::move(chunk[i]);
     }
 
-    return nextIt;
+    utility::record<ChunkedList>(&Statistics::elements_moved, chunk.size() - index - 1);
+
+    chunk.pop_back();
+    --element_count;
+
+    if (chunk.empty()) {
+      return iterator{erase(chunk_iterator{chunk})};
+    }
+
+    if (index == chunk.size()) {
+      return iterator{chunk.nextChunk};
+    }
+
+    return it;
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   typename ChunkedList<T, ChunkSize, Allocator>::chunk_iterator
   ChunkedList<T, ChunkSize, Allocator>::erase(chunk_iterator iterator) {
-    Chunk *prevPtr = iterator->prevChunk;
-    Chunk *nextPtr = iterator->nextChunk;
+    invalidate_fences();
 
-    std::destroy_at<Chunk *>(iterator);
-    ChunkAllocatorTraits::deallocate(chunk_allocator, iterator, 1);
+    Chunk *chunkPtr = iterator;
+    Chunk *prevPtr = chunkPtr->prevChunk;
+    Chunk *nextPtr = chunkPtr->nextChunk;
 
     prevPtr->nextChunk = nextPtr;
     nextPtr->prevChunk = prevPtr;
 
+    --chunk_count;
+    element_count -= chunkPtr->size();
+    deallocate_chunk(chunkPtr);
+
     return chunk_iterator{nextPtr};
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   void ChunkedList<T, ChunkSize, Allocator>::pop_chunk() {
-    Chunk *backPtr = get_sentinel()->prevChunk;
-    Chunk *prevPtr = backPtr->prevChunk;
-
-    prevPtr->nextChunk = get_sentinel();
-    get_sentinel()->prevChunk = prevPtr;
-
-    std::destroy_at(backPtr);
-    ChunkAllocatorTraits::deallocate(chunk_allocator, backPtr, 1);
+    erase(chunk_iterator{get_sentinel()->prevChunk});
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   void ChunkedList<T, ChunkSize, Allocator>::clear() {
+    invalidate_fences();
+
     Chunk *backPtr = get_sentinel()->prevChunk;
 
-    while (backPtr != sentinel) {
+    while (backPtr != get_sentinel()) {
       Chunk *prev = backPtr->prevChunk;
-      std::destroy_at(backPtr);
-      ChunkAllocatorTraits::deallocate(chunk_allocator, backPtr, 1);
+      deallocate_chunk(backPtr);
       backPtr = prev;
     }
 
     chunk_count = 0;
-    get_sentinel()->prevChunk = sentinel;
-    get_sentinel()->nextChunk = sentinel;
+    element_count = 0;
+    get_sentinel()->prevChunk = get_sentinel();
+    get_sentinel()->nextChunk = get_sentinel();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::assign(const size_t count, const T &value) {
+    ChunkedList filled{count, value, chunk_allocator};
+    clear();
+    relink_chunks(filled);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::fill(const T &value) {
+    invalidate_fences();
+
+    std::vector<Chunk *> chunkPtrs;
+    chunkPtrs.reserve(chunk_count);
+    for_each_chunk(get_sentinel(), [&chunkPtrs](Chunk &chunk) { chunkPtrs.push_back(&chunk); });
+
+    auto fillRange = [&chunkPtrs, &value](const size_t start, const size_t end) {
+      for (size_t index = start; index < end; ++index) {
+        if (index + utility::prefetch_distance < end) {
+          prefetch_chunk(chunkPtrs[index + utility::prefetch_distance]);
+        }
+
+        std::fill_n(chunkPtrs[index]->data(), chunkPtrs[index]->size(), value);
+        chunkPtrs[index]->rebuild_zone();
+      }
+    };
+
+    if (runs_in_parallel(element_count)) {
+      utility::parallel_for(chunkPtrs.size(), fillRange);
+    } else {
+      fillRange(0, chunkPtrs.size());
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::splice(ChunkedList &other) {
+    if constexpr (ChunkAllocatorTraits::is_always_equal::value) {
+      relink_chunks(other);
+    } else if (chunk_allocator == other.chunk_allocator) {
+      relink_chunks(other);
+    } else {
+      move_elements(other);
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::relink_chunks(ChunkedList &other) {
+    invalidate_fences();
+    other.invalidate_fences();
+
+    if (this == &other || other.empty()) {
+      return;
+    }
+
+    Chunk *backPtr = get_sentinel()->prevChunk;
+    Chunk *otherFrontPtr = other.get_sentinel()->nextChunk;
+    Chunk *otherBackPtr = other.get_sentinel()->prevChunk;
+
+    backPtr->nextChunk = otherFrontPtr;
+    otherFrontPtr->prevChunk = backPtr;
+    otherBackPtr->nextChunk = get_sentinel();
+    get_sentinel()->prevChunk = otherBackPtr;
+
+    chunk_count += other.chunk_count;
+    element_count += other.element_count;
+
+    other.chunk_count = 0;
+    other.element_count = 0;
+    other.get_sentinel()->prevChunk = other.get_sentinel();
+    other.get_sentinel()->nextChunk = other.get_sentinel();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::splice(ChunkedList &&other) {
+    splice(other);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::swap(ChunkedList &other) noexcept {
+    if (this == &other) {
+      return;
+    }
+
+    if constexpr (ChunkAllocatorTraits::propagate_on_container_swap::value) {
+      using std::swap;
+      swap(chunk_allocator, other.chunk_allocator);
+    }
+
+    // Relinking through an empty list keeps each sentinel in place, as the chunks at either end point to it
+    ChunkedList temporary{chunk_allocator};
+    temporary.relink_chunks(*this);
+    relink_chunks(other);
+    other.relink_chunks(temporary);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  Allocator<typename ChunkedList<T, ChunkSize, Allocator>::Chunk>
+  ChunkedList<T, ChunkSize, Allocator>::get_allocator() const {
+    return chunk_allocator;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  ChunkedList<T, ChunkSize, Allocator> ChunkedList<T, ChunkSize, Allocator>::split_at(iterator position) {
+    invalidate_fences();
+
+    Chunk *chunkPtr = &position.get_chunk();
+
+    if (chunkPtr == get_sentinel()) {
+      return ChunkedList{chunk_allocator};
+    }
+
+    if (const size_t index = position.get_index(); index != 0) {
+      Chunk *nextPtr = chunkPtr->nextChunk;
+      Chunk *splitPtr = allocate_chunk(chunkPtr, nextPtr);
+
+      for (size_t i = index; i < chunkPtr->size(); ++i) {
+        splitPtr->push_back(std::move((*chunkPtr)[i]));
+      }
+
+      utility::record<ChunkedList>(&Statistics::elements_moved, chunkPtr->size() - index);
+
+      while (chunkPtr->size() > index) {
+        chunkPtr->pop_back();
+      }
+
+      chunkPtr->nextChunk = splitPtr;
+      nextPtr->prevChunk = splitPtr;
+      ++chunk_count;
+
+      chunkPtr = splitPtr;
+    }
+
+    return extract_chunks(chunk_iterator{chunkPtr}, end<chunk_iterator>());
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  ChunkedList<T, ChunkSize, Allocator> ChunkedList<T, ChunkSize, Allocator>::extract_chunks(chunk_iterator first,
+                                                                                             chunk_iterator last) {
+    invalidate_fences();
+
+    ChunkedList extracted{chunk_allocator};
+
+    if (first == last) {
+      return extracted;
+    }
+
+    Chunk *frontPtr = first;
+    Chunk *lastPtr = last;
+    Chunk *prevPtr = frontPtr->prevChunk;
+    Chunk *backPtr = lastPtr->prevChunk;
+
+    for (Chunk *chunkPtr = frontPtr; chunkPtr != lastPtr; chunkPtr = chunkPtr->nextChunk) {
+      ++extracted.chunk_count;
+      extracted.element_count += chunkPtr->size();
+    }
+
+    prevPtr->nextChunk = lastPtr;
+    lastPtr->prevChunk = prevPtr;
+
+    frontPtr->prevChunk = extracted.get_sentinel();
+    backPtr->nextChunk = extracted.get_sentinel();
+    extracted.get_sentinel()->nextChunk = frontPtr;
+    extracted.get_sentinel()->prevChunk = backPtr;
+
+    chunk_count -= extracted.chunk_count;
+    element_count -= extracted.element_count;
+
+    return extracted;
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
@@ -381,23 +978,158 @@ namespace chunked_list {
 
     switch (Sort) {
       case BubbleSort:
-        return bubble_sort<Compare>(*this);
+        bubble_sort<Compare>(*this);
+        break;
       case SelectionSort:
-        return selection_sort<Compare>(*this);
+        selection_sort<Compare>(*this);
+        break;
       case InsertionSort:
-        return insertion_sort<Compare>(*this);
+        insertion_sort<Compare>(*this);
+        break;
       case QuickSort:
-        return quick_sort<Compare, T, ChunkSize, Allocator>(begin(), end());
+        quick_sort<Compare, T, ChunkSize, Allocator>(begin(), end());
+        break;
       case HeapSort:
-        return heap_sort<Compare>(*this);
+        heap_sort<Compare>(*this);
+        break;
+    }
+
+    if constexpr (fenced) {
+      build_fences();
     }
+
+    if constexpr (enable_zone_maps<ChunkedList>) {
+      rebuild_zone_maps();
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::build_fences()
+    requires enable_fences<ChunkedList>
+  {
+    if (!fences) {
+      fences = std::make_unique<Fences>();
+    }
+
+    fences->current = false;
+    fences->keys.clear();
+    fences->chunks.clear();
+    fences->keys.reserve(chunk_count);
+    fences->chunks.reserve(chunk_count);
+
+    for_each_chunk(std::as_const(*this).get_sentinel(), [this](const Chunk &chunk) {
+      if (!chunk.empty()) {
+        fences->keys.push_back(chunk[0]);
+        fences->chunks.push_back(&chunk);
+      }
+    });
+
+    fences->current = true;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Compare>
+  typename ChunkedList<T, ChunkSize, Allocator>::const_iterator
+  ChunkedList<T, ChunkSize, Allocator>::lower_bound(const T &value) const {
+    return find_partition_point([&value](const T &element) { return Compare{}(element, value); });
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Compare>
+  typename ChunkedList<T, ChunkSize, Allocator>::const_iterator
+  ChunkedList<T, ChunkSize, Allocator>::upper_bound(const T &value) const {
+    return find_partition_point([&value](const T &element) { return !Compare{}(value, element); });
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Compare>
+  std::pair<typename ChunkedList<T, ChunkSize, Allocator>::const_iterator,
+            typename ChunkedList<T, ChunkSize, Allocator>::const_iterator>
+  ChunkedList<T, ChunkSize, Allocator>::equal_range(const T &value) const {
+    return {lower_bound<Compare>(value), upper_bound<Compare>(value)};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Compare>
+  bool ChunkedList<T, ChunkSize, Allocator>::contains_sorted(const T &value) const {
+    const const_iterator bound = lower_bound<Compare>(value);
+    return bound != cend() && !Compare{}(value, *bound);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::rebuild_zone_maps()
+    requires enable_zone_maps<ChunkedList>
+  {
+    for_each_chunk(get_sentinel(), [](Chunk &chunk) {
+      if (!chunk.zone.current) {
+        chunk.rebuild_zone();
+      }
+    });
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  size_t ChunkedList<T, ChunkSize, Allocator>::count_between(const T &low, const T &high) const
+    requires std::totally_ordered<T>
+  {
+    size_t count = 0;
+
+    for_each_chunk(get_sentinel(), [&](const Chunk &chunk) {
+      if (chunk.within_zone(low, high)) {
+        count += chunk.size();
+      } else if (!chunk.outside_zone(low, high)) {
+        count += static_cast<size_t>(std::count_if(chunk.data(), chunk.data() + chunk.size(), [&](const T &value) {
+          return !(value < low) && !(high < value);
+        }));
+      }
+    });
+
+    return count;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename ChunkedList<T, ChunkSize, Allocator>::const_iterator
+  ChunkedList<T, ChunkSize, Allocator>::find_between(const T &low, const T &high) const
+    requires std::totally_ordered<T>
+  {
+    for (const Chunk *chunkPtr = get_sentinel()->nextChunk; chunkPtr != get_sentinel();
+         chunkPtr = chunkPtr->nextChunk) {
+      if (chunkPtr->outside_zone(low, high)) {
+        continue;
+      }
+
+      for (size_t index = 0; index < chunkPtr->size(); ++index) {
+        if (!((*chunkPtr)[index] < low) && !(high < (*chunkPtr)[index])) {
+          return const_iterator{chunkPtr, index};
+        }
+      }
+    }
+
+    return cend();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Function>
+  void ChunkedList<T, ChunkSize, Allocator>::for_each_between(const T &low, const T &high, Function function) const
+    requires std::totally_ordered<T>
+  {
+    for_each_chunk(get_sentinel(), [&](const Chunk &chunk) {
+      if (chunk.outside_zone(low, high)) {
+        return;
+      }
+
+      const bool within = chunk.within_zone(low, high);
+
+      for (const T *value = chunk.data(); value != chunk.data() + chunk.size(); ++value) {
+        if (within || (!(*value < low) && !(high < *value))) {
+          function(*value);
+        }
+      }
+    });
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   size_t ChunkedList<T, ChunkSize, Allocator>::size() const {
-    return chunk_count == 0
-             ? 0
-             : (chunk_count - 1) * ChunkSize + reinterpret_cast<const Chunk *>(&sentinel)->prevChunk->size();
+    return element_count;
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
@@ -405,55 +1137,157 @@ namespace chunked_list {
     return chunk_count == 0;
   }
 
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  MemoryUsage ChunkedList<T, ChunkSize, Allocator>::memory_usage() const {
+    return MemoryUsage{chunk_count, element_count * sizeof(T), chunk_count * sizeof(Chunk)};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  double ChunkedList<T, ChunkSize, Allocator>::fill_ratio() const {
+    if (chunk_count == 0) {
+      return 0.0;
+    }
+
+    return static_cast<double>(element_count) / static_cast<double>(chunk_count * ChunkSize);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  const Statistics &ChunkedList<T, ChunkSize, Allocator>::statistics()
+    requires enable_statistics<ChunkedList>
+  {
+    return utility::statistics_of<ChunkedList>;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::reset_statistics()
+    requires enable_statistics<ChunkedList>
+  {
+    utility::statistics_of<ChunkedList>.reset();
+  }
+
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   bool ChunkedList<T, ChunkSize, Allocator>::operator==(const ChunkedList &other) const {
-    if (size() != other.size())
+    if (element_count != other.element_count) {
       return false;
+    }
 
-    for (const_iterator thisIterator = cbegin(), otherIterator = other.begin(); thisIterator != cend();
-         ++thisIterator, ++otherIterator)
-      if (*thisIterator != *otherIterator)
-        return false;
+    std::atomic<bool> mismatch{false};
 
-    return true;
+    if (!runs_in_parallel(element_count)) {
+      return equal_from(get_sentinel()->nextChunk, 0, other.get_sentinel()->nextChunk, 0, element_count, mismatch);
+    }
+
+    // Each thread compares a range of element positions, finding the chunk holding its first position in either list
+    // by the index at which each chunk starts
+    auto collect = [](const Chunk *sentinelPtr, std::vector<const Chunk *> &chunkPtrs, std::vector<size_t> &starts) {
+      size_t start = 0;
+
+      for_each_chunk(sentinelPtr, [&](const Chunk &chunk) {
+        chunkPtrs.push_back(&chunk);
+        starts.push_back(start);
+        start += chunk.size();
+      });
+    };
+
+    std::vector<const Chunk *> chunkPtrs, otherChunkPtrs;
+    std::vector<size_t> starts, otherStarts;
+
+    collect(get_sentinel(), chunkPtrs, starts);
+    collect(other.get_sentinel(), otherChunkPtrs, otherStarts);
+
+    auto compareRange = [&](const size_t start, const size_t end) {
+      auto locate = [start](const std::vector<size_t> &chunkStarts) {
+        return static_cast<size_t>(std::upper_bound(chunkStarts.begin(), chunkStarts.end(), start) -
+                                   chunkStarts.begin() - 1);
+      };
+
+      const size_t position = locate(starts);
+      const size_t otherPosition = locate(otherStarts);
+
+      if (!equal_from(chunkPtrs[position], start - starts[position], otherChunkPtrs[otherPosition],
+                      start - otherStarts[otherPosition], end - start, mismatch)) {
+        mismatch.store(true, std::memory_order_relaxed);
+      }
+    };
+
+    utility::parallel_for(element_count, compareRange);
+    return !mismatch.load(std::memory_order_relaxed);
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   bool ChunkedList<T, ChunkSize, Allocator>::operator!=(const ChunkedList &other) const {
-    if (size() != other.size())
-      return true;
-
-    for (const_iterator thisIterator = cbegin(), otherIterator = other.begin(); thisIterator != cend();
-         ++thisIterator, ++otherIterator)
-      if (*thisIterator != *otherIterator)
-        return true;
-
-    return false;
+    return !(*this == other);
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
     requires utility::can_insert<std::ostream, T>
-  std::ostream &operator<<(std::ostream &os, ChunkedList<T, ChunkSize, Allocator> &chunkedList) {
+  std::ostream &operator<<(std::ostream &os, const ChunkedList<T, ChunkSize, Allocator> &chunkedList) {
+    if constexpr (utility::to_chars_compatible<T>) {
+      const int precision = static_cast<int>(os.precision());
+
+      // std::to_chars matches the insertion of numbers only while the stream keeps its default formatting
+      if (os.flags() == (std::ios_base::dec | std::ios_base::skipws) && os.width() == 0 &&
+          precision <= utility::max_fast_precision && os.getloc() == std::locale::classic()) {
+        constexpr size_t bufferSize = 4096;
+
+        char buffer[bufferSize];
+        char *const last = buffer + bufferSize;
+        char *position = buffer;
+
+        bool first = true;
+
+        *position++ = '[';
+
+        chunkedList.for_each_segment([&](const T *data, const size_t size) {
+          for (size_t index = 0; index < size; ++index) {
+            if (static_cast<size_t>(last - position) < utility::to_chars_buffer_size + 2) {
+              os.write(buffer, position - buffer);
+              position = buffer;
+            }
+
+            if (!first) {
+              *position++ = ',';
+              *position++ = ' ';
+            }
+
+            first = false;
+
+            position = utility::write_chars(position, last, data[index], precision);
+          }
+        });
+
+        *position++ = ']';
+
+        return os.write(buffer, position - buffer);
+      }
+    }
+
     os << '[';
 
-    auto iterator = chunkedList.begin(), end = chunkedList.end();
+    bool first = true;
 
-    os << *iterator;
-    ++iterator;
+    for (const T &value : chunkedList) {
+      if (!first) {
+        os << ", ";
+      }
 
-    while (iterator != end) {
-      os << ", " << *iterator;
-      ++iterator;
+      os << value;
+      first = false;
     }
 
     return os << ']';
   }
 
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void swap(ChunkedList<T, ChunkSize, Allocator> &left, ChunkedList<T, ChunkSize, Allocator> &right) noexcept {
+    left.swap(right);
+  }
+
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<typename OutputStream, typename DelimiterType>
     requires utility::can_insert<OutputStream, T> && utility::can_insert<OutputStream, DelimiterType> &&
              utility::can_stringify<OutputStream>
-  auto ChunkedList<T, ChunkSize, Allocator>::concat(const DelimiterType delimiter)
+  auto ChunkedList<T, ChunkSize, Allocator>::concat(const DelimiterType delimiter) const
     -> utility::DeduceStreamStringType<OutputStream> {
     using StringType = utility::DeduceStreamStringType<OutputStream>;
 
@@ -461,20 +1295,263 @@ namespace chunked_list {
       return StringType{};
     }
 
-    OutputStream stream;
+    if constexpr (std::is_same_v<OutputStream, std::ostringstream> && utility::to_chars_compatible<T> &&
+                  std::is_convertible_v<const DelimiterType &, std::string_view>) {
+      const std::string_view delimiterView{delimiter};
 
-    iterator it = begin(), endIt = end();
+      // Measuring every number first sizes the string exactly, so it is allocated once and never grown
+      size_t length = delimiterView.size() * (element_count - 1);
 
-    stream << *it;
-    ++it;
+      for_each_segment([&length](const T *data, const size_t size) {
+        for (size_t index = 0; index < size; ++index) {
+          length += utility::chars_length(data[index]);
+        }
+      });
+
+      StringType result(length, '\0');
+
+      char *const first = result.data();
+      char *const last = first + length;
+      char *position = first;
+
+      for_each_segment([&](const T *data, const size_t size) {
+        for (size_t index = 0; index < size; ++index) {
+          if (position != first) {
+            position = std::copy(delimiterView.begin(), delimiterView.end(), position);
+          }
+
+          position = utility::write_chars(position, last, data[index]);
+        }
+      });
+
+      return result;
+    } else {
+      OutputStream stream;
 
-    while (it != endIt) {
-      stream << delimiter << *it;
+      const_iterator it = begin(), endIt = end();
+
+      stream << *it;
       ++it;
+
+      while (it != endIt) {
+        stream << delimiter << *it;
+        ++it;
+      }
+
+      return stream.str();
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Writer>
+  void ChunkedList<T, ChunkSize, Allocator>::write_binary_with(Writer write) const {
+    utility::BinaryHeader header;
+    header.value_size = sizeof(T);
+    header.element_count = element_count;
+
+    write(&header, sizeof(header));
+
+    for (const_chunk_iterator chunkIt = begin<const_chunk_iterator>(); chunkIt != end<const_chunk_iterator>();
+         ++chunkIt) {
+      write(chunkIt->data(), chunkIt->size() * sizeof(T));
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Reader>
+  void ChunkedList<T, ChunkSize, Allocator>::read_binary_with(Reader read) {
+    utility::BinaryHeader header;
+    read(&header, sizeof(header));
+
+    if (std::memcmp(header.magic, utility::BinaryHeader{}.magic, sizeof(header.magic)) != 0 ||
+        header.version != utility::BinaryHeader::current_version) {
+      throw std::runtime_error("Invalid chunked list binary header!");
+    }
+
+    if (header.value_size != sizeof(T)) {
+      throw std::runtime_error(
+        utility::concatenate("Expected elements of ", sizeof(T), " bytes but received ", header.value_size, '!'));
+    }
+
+    ChunkedList loaded{chunk_allocator};
+
+    for (size_t remaining = header.element_count; remaining > 0;) {
+      const size_t count = std::min(ChunkSize, remaining);
+      Chunk *chunkPtr = loaded.push_chunk();
+
+      read(chunkPtr->data(), count * sizeof(T));
+      chunkPtr->nextIndex = count;
+      chunkPtr->rebuild_zone();
+      loaded.element_count += count;
+
+      remaining -= count;
+    }
+
+    *this = std::move(loaded);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::write_binary(std::ostream &os) const
+    requires std::is_trivially_copyable_v<T>
+  {
+    write_binary_with([&os](const void *bytes, const size_t size) {
+      if (!os.write(static_cast<const char *>(bytes), static_cast<std::streamsize>(size))) {
+        throw std::runtime_error("Failed to write chunked list to ostream!");
+      }
+    });
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::read_binary(std::istream &is)
+    requires std::is_trivially_copyable_v<T>
+  {
+    read_binary_with([&is](void *bytes, const size_t size) {
+      if (!is.read(static_cast<char *>(bytes), static_cast<std::streamsize>(size))) {
+        throw std::runtime_error("Failed to read chunked list from istream!");
+      }
+    });
+  }
+
+#if CHUNKED_LIST_POSIX
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::write_binary(const int fd) const
+    requires std::is_trivially_copyable_v<T>
+  {
+    write_binary_with([fd](const void *bytes, const size_t size) { utility::write_fd(fd, bytes, size); });
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::read_binary(const int fd)
+    requires std::is_trivially_copyable_v<T>
+  {
+    read_binary_with([fd](void *bytes, const size_t size) { utility::read_fd(fd, bytes, size); });
+  }
+#endif
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Function>
+  void ChunkedList<T, ChunkSize, Allocator>::for_each_segment(Function function) {
+    invalidate_fences();
+    for_each_chunk(get_sentinel(), [&function](Chunk &chunk) { function(chunk.data(), chunk.size()); });
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Function>
+  void ChunkedList<T, ChunkSize, Allocator>::for_each_segment(Function function) const {
+    for_each_chunk(get_sentinel(), [&function](const Chunk &chunk) { function(chunk.data(), chunk.size()); });
+  }
+
+#if CHUNKED_LIST_POSIX
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  std::vector<iovec> ChunkedList<T, ChunkSize, Allocator>::as_iovecs() const
+    requires std::is_trivially_copyable_v<T>
+  {
+    std::vector<iovec> iovecs;
+    iovecs.reserve(chunk_count);
+
+    // iovec is shared by readv and writev, so its base is not const even though writev never writes through it
+    for_each_segment([&iovecs](const T *data, const size_t size) {
+      iovecs.push_back(iovec{const_cast<T *>(data), size * sizeof(T)});
+    });
+
+    return iovecs;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void ChunkedList<T, ChunkSize, Allocator>::write_segments(const int fd) const
+    requires std::is_trivially_copyable_v<T>
+  {
+    std::vector<iovec> iovecs = as_iovecs();
+    utility::writev_fd(fd, iovecs.data(), iovecs.size());
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  size_t ChunkedList<T, ChunkSize, Allocator>::read_segments(const int fd, const size_t count)
+    requires std::is_trivially_copyable_v<T>
+  {
+    invalidate_fences();
+
+    Chunk *sentinelPtr = get_sentinel();
+    Chunk *firstPtr = sentinelPtr->prevChunk;
+
+    std::vector<iovec> iovecs;
+    size_t planned = 0;
+
+    if (firstPtr != sentinelPtr && firstPtr->size() < ChunkSize && count > 0) {
+      planned = std::min(ChunkSize - firstPtr->size(), count);
+      iovecs.push_back(iovec{firstPtr->data() + firstPtr->size(), planned * sizeof(T)});
+    } else {
+      firstPtr = nullptr;
+    }
+
+    auto trimEmptyChunks = [this, sentinelPtr] {
+      while (sentinelPtr->prevChunk != sentinelPtr && sentinelPtr->prevChunk->empty()) {
+        pop_chunk();
+      }
+    };
+
+    ssize_t received = 0;
+
+    try {
+      while (planned < count && iovecs.size() < utility::iov_max) {
+        const size_t size = std::min(ChunkSize, count - planned);
+        Chunk *chunkPtr = push_chunk();
+
+        if (!firstPtr) {
+          firstPtr = chunkPtr;
+        }
+
+        iovecs.push_back(iovec{chunkPtr->data(), size * sizeof(T)});
+        planned += size;
+      }
+
+      if (iovecs.empty()) {
+        return 0;
+      }
+
+      do {
+        received = ::readv(fd, iovecs.data(), static_cast<int>(iovecs.size()));
+      } while (received < 0 && errno == EINTR);
+
+      if (received < 0) {
+        throw std::runtime_error(utility::concatenate("Failed to read from file descriptor ", fd, "!"));
+      }
+
+      // Elements are never split, so the rest of an element which was only partly read is waited for
+      if (const size_t partial = static_cast<size_t>(received) % sizeof(T); partial != 0) {
+        const size_t missing = sizeof(T) - partial;
+        size_t offset = static_cast<size_t>(received);
+        size_t iovecIndex = 0;
+
+        for (; offset >= iovecs[iovecIndex].iov_len; ++iovecIndex) {
+          offset -= iovecs[iovecIndex].iov_len;
+        }
+
+        utility::read_fd(fd, static_cast<std::byte *>(iovecs[iovecIndex].iov_base) + offset, missing);
+        received += static_cast<ssize_t>(missing);
+      }
+    } catch (...) {
+      trimEmptyChunks();
+      throw;
     }
 
-    return stream.str();
+    const size_t elements = static_cast<size_t>(received) / sizeof(T);
+
+    Chunk *chunkPtr = firstPtr;
+
+    for (size_t remaining = elements; remaining > 0; chunkPtr = chunkPtr->nextChunk) {
+      const size_t filled = std::min(ChunkSize - chunkPtr->size(), remaining);
+      chunkPtr->nextIndex += filled;
+      chunkPtr->rebuild_zone();
+      remaining -= filled;
+    }
+
+    element_count += elements;
+    trimEmptyChunks();
+
+    return elements;
   }
+#endif
 } // namespace chunked_list
 
 template<chunked_list::utility::chunked_list ChunkedListType, typename IteratorType>
@@ -547,3 +1624,56 @@ template<chunked_list::utility::chunked_list ChunkedListType, typename ConstReve
 ConstReverseIteratorType crend(const ChunkedListType &chunkedList) noexcept {
   return chunkedList.template crend<ConstReverseIteratorType>();
 }
+
+#if CHUNKED_LIST_FORMAT
+template<typename T, size_t ChunkSize, template<typename> typename Allocator, typename CharT>
+constexpr typename std::basic_format_parse_context<CharT>::iterator
+std::formatter<chunked_list::ChunkedList<T, ChunkSize, Allocator>, CharT>::parse(
+  std::basic_format_parse_context<CharT> &context) {
+  return element_formatter.parse(context);
+}
+
+template<typename T, size_t ChunkSize, template<typename> typename Allocator, typename CharT>
+template<typename FormatContext>
+typename FormatContext::iterator std::formatter<chunked_list::ChunkedList<T, ChunkSize, Allocator>, CharT>::format(
+  const chunked_list::ChunkedList<T, ChunkSize, Allocator> &chunkedList, FormatContext &context) const {
+  auto out = context.out();
+  *out++ = CharT('[');
+
+  bool first = true;
+
+  for (const T &value : chunkedList) {
+    if (!first) {
+      *out++ = CharT(',');
+      *out++ = CharT(' ');
+    }
+
+    context.advance_to(out);
+    out = element_formatter.format(value, context);
+    first = false;
+  }
+
+  *out++ = CharT(']');
+  return out;
+}
+#endif
+
+template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  requires chunked_list::utility::bytewise_comparable<T> || chunked_list::utility::hashable<T>
+size_t std::hash<chunked_list::ChunkedList<T, ChunkSize, Allocator>>::operator()(
+  const chunked_list::ChunkedList<T, ChunkSize, Allocator> &chunkedList) const {
+  chunked_list::utility::StreamHasher hasher;
+
+  chunkedList.for_each_segment([&hasher](const T *data, const size_t size) {
+    if constexpr (chunked_list::utility::bytewise_comparable<T>) {
+      hasher.update(data, size * sizeof(T));
+    } else {
+      for (size_t index = 0; index < size; ++index) {
+        const size_t elementHash = std::hash<T>{}(data[index]);
+        hasher.update(&elementHash, sizeof(elementHash));
+      }
+    }
+  });
+
+  return static_cast<size_t>(hasher.digest());
+}
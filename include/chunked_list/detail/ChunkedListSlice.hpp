@@ -1,15 +1,18 @@
 #pragma once
 
+#include <ranges>
+
 #include "../ChunkedList.hpp"
 
 namespace chunked_list {
   /**
-   * @brief A generic slice for referencing parts of the chunked list
+   * @brief A generic slice for referencing parts of the chunked list, which is a borrowed view whose constness is
+   * shallow, like std::span
    * @tparam ChunkedListType The type of chunked list that the slice will reference
    * @tparam Mutable Whether mutating the memory stored is allowed
    */
   template<typename ChunkedListType, bool Mutable>
-  class ChunkedListSlice {
+  class ChunkedListSlice : public std::ranges::view_interface<ChunkedListSlice<ChunkedListType, Mutable>> {
 
       using ValueT =
         std::conditional_t<Mutable, typename ChunkedListType::value_type, const typename ChunkedListType::value_type>;
@@ -62,12 +65,22 @@ namespace chunked_list {
       template<typename SliceT>
       bool operator!=(SliceT other) const;
 
-      iterator_type begin();
+      iterator_type begin() const;
 
       const_iterator_type cbegin() const;
 
-      iterator_type end();
+      iterator_type end() const;
 
       const_iterator_type cend() const;
+
+      /**
+       * @brief Counts the elements referenced by the slice, walking its chunks rather than its elements
+       * @return The number of elements referenced by the slice
+       */
+      size_t size() const;
   };
 } // namespace chunked_list
+
+template<typename ChunkedListType, bool Mutable>
+inline constexpr bool std::ranges::enable_borrowed_range<chunked_list::ChunkedListSlice<ChunkedListType, Mutable>> =
+  true;
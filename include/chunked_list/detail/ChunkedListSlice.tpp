@@ -13,19 +13,21 @@ namespace chunked_list {
   template<typename StartChunkIteratorT, typename EndChunkIteratorT>
     requires utility::are_chunk_iterators<ChunkedListT, StartChunkIteratorT, EndChunkIteratorT>
   ChunkedListSlice<ChunkedListT, Mutable>::ChunkedListSlice(StartChunkIteratorT start, EndChunkIteratorT last) :
-      startIterator{start}, endIterator{last, last->nextIndex} {}
+      startIterator{start}, endIterator{++last} {}
 
   template<typename ChunkedListT, bool Mutable>
   typename ChunkedListSlice<ChunkedListT, Mutable>::ValueT &
   ChunkedListSlice<ChunkedListT, Mutable>::operator[](size_t index) {
     index += startIterator.get_index();
     auto targetChunk = startIterator.get_chunk_iterator();
+    size_t walked = 0;
 
-    while (index >= ChunkedListT::chunk_size) {
-      index -= ChunkedListT::chunk_size;
+    for (; index >= targetChunk->size(); ++walked) {
+      index -= targetChunk->size();
       ++targetChunk;
     }
 
+    utility::record_walk<ChunkedListT>(walked);
     return (*targetChunk)[index];
   }
 
@@ -48,7 +50,8 @@ namespace chunked_list {
   }
 
   template<typename ChunkedListT, bool Mutable>
-  typename ChunkedListSlice<ChunkedListT, Mutable>::iterator_type ChunkedListSlice<ChunkedListT, Mutable>::begin() {
+  typename ChunkedListSlice<ChunkedListT, Mutable>::iterator_type
+  ChunkedListSlice<ChunkedListT, Mutable>::begin() const {
     return startIterator;
   }
 
@@ -59,7 +62,8 @@ namespace chunked_list {
   }
 
   template<typename ChunkedListT, bool Mutable>
-  typename ChunkedListSlice<ChunkedListT, Mutable>::iterator_type ChunkedListSlice<ChunkedListT, Mutable>::end() {
+  typename ChunkedListSlice<ChunkedListT, Mutable>::iterator_type
+  ChunkedListSlice<ChunkedListT, Mutable>::end() const {
     return endIterator;
   }
 
@@ -68,4 +72,18 @@ namespace chunked_list {
   ChunkedListSlice<ChunkedListT, Mutable>::cend() const {
     return endIterator;
   }
+
+  template<typename ChunkedListT, bool Mutable>
+  size_t ChunkedListSlice<ChunkedListT, Mutable>::size() const {
+    iterator_type start = startIterator;
+    iterator_type end = endIterator;
+    chunk_iterator endChunk = end.get_chunk_iterator();
+    size_t count = end.get_index() - start.get_index();
+
+    for (chunk_iterator chunkIt = start.get_chunk_iterator(); chunkIt != endChunk; ++chunkIt) {
+      count += chunkIt->size();
+    }
+
+    return count;
+  }
 } // namespace chunked_list
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <ranges>
+#include <span>
+
+#include "../ChunkedList.hpp"
+
+namespace chunked_list {
+  /**
+   * @brief A view over the chunks referenced by a range of a chunked list, yielding the elements of each chunk as a
+   * span, so pipelines joining the view walk each chunk as contiguous memory
+   * @tparam ChunkedListType The type of chunked list that the view will reference
+   * @tparam Mutable Whether mutating the memory stored is allowed
+   */
+  template<typename ChunkedListType, bool Mutable>
+  class ChunkView : public std::ranges::view_interface<ChunkView<ChunkedListType, Mutable>> {
+      using ValueT =
+        std::conditional_t<Mutable, typename ChunkedListType::value_type, const typename ChunkedListType::value_type>;
+
+      using chunk_iterator = typename ChunkedListType::template generic_chunk_iterator<Mutable>;
+      using iterator_type = typename ChunkedListType::template generic_iterator<Mutable>;
+
+      iterator_type startIterator;
+      iterator_type endIterator;
+
+    public:
+      /**
+       * @brief A bidirectional iterator yielding the part of each chunk which lies within the view. Each span is
+       * returned by value, so to the legacy iterator requirements, which need a reference, it is only an input iterator
+       */
+      class iterator {
+          chunk_iterator chunkIterator{};
+          chunk_iterator startChunk{};
+          chunk_iterator endChunk{};
+          size_t startIndex{0};
+          size_t endIndex{0};
+
+        public:
+          using value_type = std::span<ValueT>;
+          using difference_type = std::ptrdiff_t;
+          using iterator_category = std::input_iterator_tag;
+          using iterator_concept = std::bidirectional_iterator_tag;
+
+          iterator() = default;
+
+          /**
+           * @param chunkIt The chunk currently referenced by the iterator
+           * @param start The first element of the view
+           * @param end The element after the last element of the view
+           */
+          iterator(chunk_iterator chunkIt, iterator_type start, iterator_type end);
+
+          /**
+           * @return A span over the elements of the current chunk which lie within the view
+           */
+          value_type operator*() const;
+
+          iterator &operator++();
+
+          iterator operator++(int);
+
+          iterator &operator--();
+
+          iterator operator--(int);
+
+          bool operator==(const iterator &other) const;
+      };
+
+      ChunkView() = default;
+
+      /**
+       * @brief Constructs a view over the chunks from the start iterator to the end iterator (inclusive-exclusive)
+       * @param start The iterator for the start of the view (inclusive)
+       * @param end The iterator for the end of the view (exclusive)
+       */
+      ChunkView(iterator_type start, iterator_type end);
+
+      iterator begin() const;
+
+      iterator end() const;
+  };
+
+  namespace views {
+    /**
+     * @brief The range adaptor object behind views::chunks
+     */
+    struct chunks_fn {
+        template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+        ChunkView<ChunkedList<T, ChunkSize, Allocator>, true>
+        operator()(ChunkedList<T, ChunkSize, Allocator> &list) const;
+
+        template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+        ChunkView<ChunkedList<T, ChunkSize, Allocator>, false>
+        operator()(const ChunkedList<T, ChunkSize, Allocator> &list) const;
+
+        /**
+         * @brief Temporary chunked lists would leave the view dangling
+         */
+        template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+        void operator()(ChunkedList<T, ChunkSize, Allocator> &&list) const = delete;
+
+        template<typename ChunkedListType, bool Mutable>
+        ChunkView<ChunkedListType, Mutable> operator()(const ChunkedListSlice<ChunkedListType, Mutable> &slice) const;
+
+        template<typename RangeT>
+          requires std::invocable<const chunks_fn &, RangeT>
+        friend auto operator|(RangeT &&range, const chunks_fn &adaptor) {
+          return adaptor(std::forward<RangeT>(range));
+        }
+    };
+
+    /**
+     * @brief Adapts a chunked list or a slice of one into a view of spans over its chunks, as in
+     * list | views::chunks | std::views::join
+     */
+    inline constexpr chunks_fn chunks{};
+  } // namespace views
+} // namespace chunked_list
+
+template<typename ChunkedListType, bool Mutable>
+inline constexpr bool std::ranges::enable_borrowed_range<chunked_list::ChunkView<ChunkedListType, Mutable>> = true;
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "../ChunkedList.hpp"
+
+namespace chunked_list {
+  template<typename ChunkedListT, bool Mutable>
+  ChunkView<ChunkedListT, Mutable>::iterator::iterator(chunk_iterator chunkIt, iterator_type start,
+                                                       iterator_type end) :
+      chunkIterator{chunkIt}, startChunk{start.get_chunk_iterator()}, endChunk{end.get_chunk_iterator()},
+      startIndex{start.get_index()}, endIndex{end.get_index()} {}
+
+  template<typename ChunkedListT, bool Mutable>
+  typename ChunkView<ChunkedListT, Mutable>::iterator::value_type
+  ChunkView<ChunkedListT, Mutable>::iterator::operator*() const {
+    const size_t first = chunkIterator == startChunk ? startIndex : 0;
+    const size_t last = chunkIterator == endChunk ? endIndex : chunkIterator->size();
+    return value_type{chunkIterator->data() + first, last - first};
+  }
+
+  template<typename ChunkedListT, bool Mutable>
+  typename ChunkView<ChunkedListT, Mutable>::iterator &ChunkView<ChunkedListT, Mutable>::iterator::operator++() {
+    ++chunkIterator;
+    return *this;
+  }
+
+  template<typename ChunkedListT, bool Mutable>
+  typename ChunkView<ChunkedListT, Mutable>::iterator ChunkView<ChunkedListT, Mutable>::iterator::operator++(int) {
+    iterator original = *this;
+    ++chunkIterator;
+    return original;
+  }
+
+  template<typename ChunkedListT, bool Mutable>
+  typename ChunkView<ChunkedListT, Mutable>::iterator &ChunkView<ChunkedListT, Mutable>::iterator::operator--() {
+    --chunkIterator;
+    return *this;
+  }
+
+  template<typename ChunkedListT, bool Mutable>
+  typename ChunkView<ChunkedListT, Mutable>::iterator ChunkView<ChunkedListT, Mutable>::iterator::operator--(int) {
+    iterator original = *this;
+    --chunkIterator;
+    return original;
+  }
+
+  template<typename ChunkedListT, bool Mutable>
+  bool ChunkView<ChunkedListT, Mutable>::iterator::operator==(const iterator &other) const {
+    return chunkIterator == other.chunkIterator;
+  }
+
+  template<typename ChunkedListT, bool Mutable>
+  ChunkView<ChunkedListT, Mutable>::ChunkView(iterator_type start, iterator_type end) :
+      startIterator{start}, endIterator{end} {}
+
+  template<typename ChunkedListT, bool Mutable>
+  typename ChunkView<ChunkedListT, Mutable>::iterator ChunkView<ChunkedListT, Mutable>::begin() const {
+    // An empty view which starts partway through a chunk would otherwise yield that chunk as an empty span
+    if (startIterator == endIterator) {
+      return end();
+    }
+
+    iterator_type start = startIterator;
+    return iterator{start.get_chunk_iterator(), startIterator, endIterator};
+  }
+
+  template<typename ChunkedListT, bool Mutable>
+  typename ChunkView<ChunkedListT, Mutable>::iterator ChunkView<ChunkedListT, Mutable>::end() const {
+    iterator_type end = endIterator;
+    chunk_iterator endChunk = end.get_chunk_iterator();
+
+    // A view ending partway through a chunk still yields that chunk, so its iteration ends after it
+    if (end.get_index() != 0) {
+      ++endChunk;
+    }
+
+    return iterator{endChunk, startIterator, endIterator};
+  }
+
+  namespace views {
+    template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+    ChunkView<ChunkedList<T, ChunkSize, Allocator>, true>
+    chunks_fn::operator()(ChunkedList<T, ChunkSize, Allocator> &list) const {
+      return ChunkView<ChunkedList<T, ChunkSize, Allocator>, true>{list.begin(), list.end()};
+    }
+
+    template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+    ChunkView<ChunkedList<T, ChunkSize, Allocator>, false>
+    chunks_fn::operator()(const ChunkedList<T, ChunkSize, Allocator> &list) const {
+      return ChunkView<ChunkedList<T, ChunkSize, Allocator>, false>{list.begin(), list.end()};
+    }
+
+    template<typename ChunkedListType, bool Mutable>
+    ChunkView<ChunkedListType, Mutable>
+    chunks_fn::operator()(const ChunkedListSlice<ChunkedListType, Mutable> &slice) const {
+      return ChunkView<ChunkedListType, Mutable>{slice.begin(), slice.end()};
+    }
+  } // namespace views
+} // namespace chunked_list
@@ -0,0 +1,421 @@
+#pragma once
+
+#include <new>
+
+#include "../ChunkedSoA.hpp"
+
+namespace chunked_list {
+  // ---------------------------------------------------------------------------------------------------------------------
+  // Chunk implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<typename FieldT>
+  FieldT *BasicChunkedSoA<ChunkSize, Allocator, Ts...>::FieldArray<FieldT>::data() {
+    return std::launder(reinterpret_cast<FieldT *>(bytes));
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<typename FieldT>
+  const FieldT *BasicChunkedSoA<ChunkSize, Allocator, Ts...>::FieldArray<FieldT>::data() const {
+    return std::launder(reinterpret_cast<const FieldT *>(bytes));
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::Chunk::Chunk(ChunkLinks *prevChunk, ChunkLinks *nextChunk) :
+      ChunkLinks{prevChunk, nextChunk} {}
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::Chunk::~Chunk() {
+    while (recordCount > 0) {
+      pop_back();
+    }
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<typename... Args>
+  void BasicChunkedSoA<ChunkSize, Allocator, Ts...>::Chunk::emplace_back(Args &&...args) {
+    [&]<size_t... Fields>(std::index_sequence<Fields...>) {
+      size_t constructed = 0;
+
+      try {
+        ((std::construct_at(std::get<Fields>(fields).data() + recordCount, std::forward<Args>(args)), ++constructed),
+         ...);
+      } catch (...) {
+        // Fields are constructed in order, so the ones before the throwing field are destroyed
+        ((Fields < constructed ? std::destroy_at(std::get<Fields>(fields).data() + recordCount) : void()), ...);
+        throw;
+      }
+    }(std::index_sequence_for<Ts...>{});
+
+    ++recordCount;
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  void BasicChunkedSoA<ChunkSize, Allocator, Ts...>::Chunk::pop_back() {
+    --recordCount;
+    std::apply([this](auto &...arrays) { (std::destroy_at(arrays.data() + recordCount), ...); }, fields);
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  size_t BasicChunkedSoA<ChunkSize, Allocator, Ts...>::Chunk::size() const {
+    return recordCount;
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::reference
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::Chunk::operator[](const size_t index) {
+    return std::apply([index](auto &...arrays) { return reference{arrays.data()[index]...}; }, fields);
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::const_reference
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::Chunk::operator[](const size_t index) const {
+    return std::apply([index](const auto &...arrays) { return const_reference{arrays.data()[index]...}; }, fields);
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<size_t Field>
+  std::span<typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::template field_type<Field>>
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::Chunk::field() {
+    return {std::get<Field>(fields).data(), recordCount};
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<size_t Field>
+  std::span<const typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::template field_type<Field>>
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::Chunk::field() const {
+    return {std::get<Field>(fields).data(), recordCount};
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------------
+  // generic_iterator implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<bool Mutable>
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::generic_iterator<Mutable>::generic_iterator(LinksT *chunkPtr,
+                                                                                             const size_t index) :
+      chunk{chunkPtr}, index{index} {}
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<bool Mutable>
+  template<bool OtherMutable>
+    requires(OtherMutable && !Mutable)
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::generic_iterator<Mutable>::generic_iterator(
+    const generic_iterator<OtherMutable> &other) : chunk{other.chunk}, index{other.index} {}
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<bool Mutable>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::template generic_iterator<Mutable>::reference
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::generic_iterator<Mutable>::operator*() const {
+    return (*static_cast<ChunkT *>(chunk))[index];
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<bool Mutable>
+  template<size_t Field>
+  std::conditional_t<Mutable, typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::template field_type<Field>,
+                     const typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::template field_type<Field>> &
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::generic_iterator<Mutable>::get() const {
+    return static_cast<ChunkT *>(chunk)->template field<Field>()[index];
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<bool Mutable>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::template generic_iterator<Mutable> &
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::generic_iterator<Mutable>::operator++() {
+    if (++index >= static_cast<ChunkT *>(chunk)->size()) {
+      chunk = chunk->nextChunk;
+      index = 0;
+    }
+
+    return *this;
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<bool Mutable>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::template generic_iterator<Mutable>
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::generic_iterator<Mutable>::operator++(int) {
+    generic_iterator original = *this;
+    operator++();
+    return original;
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<bool Mutable>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::template generic_iterator<Mutable> &
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::generic_iterator<Mutable>::operator--() {
+    if (index == 0) {
+      chunk = chunk->prevChunk;
+      index = static_cast<ChunkT *>(chunk)->size() - 1;
+    } else {
+      --index;
+    }
+
+    return *this;
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<bool Mutable>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::template generic_iterator<Mutable>
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::generic_iterator<Mutable>::operator--(int) {
+    generic_iterator original = *this;
+    operator--();
+    return original;
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<bool Mutable>
+  bool BasicChunkedSoA<ChunkSize, Allocator, Ts...>::generic_iterator<Mutable>::operator==(
+    const generic_iterator &other) const {
+    return chunk == other.chunk && index == other.index;
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------------
+  // BasicChunkedSoA implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::Chunk *
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::find_chunk(size_t &index) const {
+    // Every chunk but the back one is full, so the chunk holding a record follows from its index
+    size_t target = index / ChunkSize;
+    index %= ChunkSize;
+
+    ChunkLinks *chunkPtr;
+
+    if (target <= chunk_count / 2) {
+      for (chunkPtr = sentinel.nextChunk; target > 0; --target) {
+        chunkPtr = chunkPtr->nextChunk;
+      }
+    } else {
+      for (chunkPtr = sentinel.prevChunk; ++target < chunk_count;) {
+        chunkPtr = chunkPtr->prevChunk;
+      }
+    }
+
+    return static_cast<Chunk *>(chunkPtr);
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::Chunk *
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::push_chunk() {
+    Chunk *chunkPtr = ChunkAllocatorTraits::allocate(chunk_allocator, 1);
+    new (chunkPtr) Chunk{sentinel.prevChunk, &sentinel};
+
+    sentinel.prevChunk->nextChunk = chunkPtr;
+    sentinel.prevChunk = chunkPtr;
+
+    ++chunk_count;
+    return chunkPtr;
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  void BasicChunkedSoA<ChunkSize, Allocator, Ts...>::pop_chunk() {
+    Chunk *chunkPtr = static_cast<Chunk *>(sentinel.prevChunk);
+
+    sentinel.prevChunk = chunkPtr->prevChunk;
+    sentinel.prevChunk->nextChunk = &sentinel;
+
+    std::destroy_at(chunkPtr);
+    ChunkAllocatorTraits::deallocate(chunk_allocator, chunkPtr, 1);
+    --chunk_count;
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::BasicChunkedSoA(const BasicChunkedSoA &other) :
+      chunk_allocator{ChunkAllocatorTraits::select_on_container_copy_construction(other.chunk_allocator)} {
+    try {
+      for (const_reference record : other) {
+        push_back(value_type{record});
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::BasicChunkedSoA(BasicChunkedSoA &&other) noexcept :
+      chunk_allocator{std::move(other.chunk_allocator)} {
+    operator=(std::move(other));
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...> &
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::operator=(const BasicChunkedSoA &other) {
+    if (this != &other) {
+      BasicChunkedSoA copy{other};
+      operator=(std::move(copy));
+    }
+
+    return *this;
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...> &
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::operator=(BasicChunkedSoA &&other) noexcept {
+    if (this == &other) {
+      return *this;
+    }
+
+    clear();
+
+    if (other.chunk_count == 0) {
+      return *this;
+    }
+
+    // The chunks are relinked to this sentinel, which requires allocators able to free each other's chunks
+    sentinel.nextChunk = other.sentinel.nextChunk;
+    sentinel.prevChunk = other.sentinel.prevChunk;
+    sentinel.nextChunk->prevChunk = &sentinel;
+    sentinel.prevChunk->nextChunk = &sentinel;
+    chunk_count = other.chunk_count;
+    element_count = other.element_count;
+
+    other.sentinel.nextChunk = other.sentinel.prevChunk = &other.sentinel;
+    other.chunk_count = other.element_count = 0;
+
+    return *this;
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::~BasicChunkedSoA() {
+    clear();
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<typename... Args>
+    requires(sizeof...(Args) == sizeof...(Ts))
+  void BasicChunkedSoA<ChunkSize, Allocator, Ts...>::emplace_back(Args &&...args) {
+    Chunk *backPtr = chunk_count == 0 ? nullptr : static_cast<Chunk *>(sentinel.prevChunk);
+    const bool pushedChunk = !backPtr || backPtr->size() == ChunkSize;
+
+    if (pushedChunk) {
+      backPtr = push_chunk();
+    }
+
+    try {
+      backPtr->emplace_back(std::forward<Args>(args)...);
+    } catch (...) {
+      if (pushedChunk) {
+        pop_chunk();
+      }
+
+      throw;
+    }
+
+    ++element_count;
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  void BasicChunkedSoA<ChunkSize, Allocator, Ts...>::push_back(const value_type &record) {
+    std::apply([this](const Ts &...fields) { emplace_back(fields...); }, record);
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  void BasicChunkedSoA<ChunkSize, Allocator, Ts...>::push_back(value_type &&record) {
+    std::apply([this](Ts &...fields) { emplace_back(std::move(fields)...); }, record);
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  void BasicChunkedSoA<ChunkSize, Allocator, Ts...>::pop_back() {
+    Chunk *backPtr = static_cast<Chunk *>(sentinel.prevChunk);
+    backPtr->pop_back();
+    --element_count;
+
+    if (backPtr->size() == 0) {
+      pop_chunk();
+    }
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  void BasicChunkedSoA<ChunkSize, Allocator, Ts...>::clear() {
+    while (chunk_count > 0) {
+      pop_chunk();
+    }
+
+    element_count = 0;
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::reference
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::operator[](size_t index) {
+    Chunk *chunkPtr = find_chunk(index);
+    return (*chunkPtr)[index];
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::const_reference
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::operator[](size_t index) const {
+    const Chunk *chunkPtr = find_chunk(index);
+    return (*chunkPtr)[index];
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<size_t Field>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::template field_type<Field> &
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::get(size_t index) {
+    Chunk *chunkPtr = find_chunk(index);
+    return chunkPtr->template field<Field>()[index];
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<size_t Field>
+  const typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::template field_type<Field> &
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::get(size_t index) const {
+    const Chunk *chunkPtr = find_chunk(index);
+    return chunkPtr->template field<Field>()[index];
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<size_t Field, typename Function>
+  void BasicChunkedSoA<ChunkSize, Allocator, Ts...>::for_each_span(Function function) {
+    for (ChunkLinks *chunkPtr = sentinel.nextChunk; chunkPtr != &sentinel; chunkPtr = chunkPtr->nextChunk) {
+      function(static_cast<Chunk *>(chunkPtr)->template field<Field>());
+    }
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  template<size_t Field, typename Function>
+  void BasicChunkedSoA<ChunkSize, Allocator, Ts...>::for_each_span(Function function) const {
+    for (const ChunkLinks *chunkPtr = sentinel.nextChunk; chunkPtr != &sentinel; chunkPtr = chunkPtr->nextChunk) {
+      function(static_cast<const Chunk *>(chunkPtr)->template field<Field>());
+    }
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::iterator
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::begin() {
+    return iterator{sentinel.nextChunk, 0};
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::const_iterator
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::begin() const {
+    return const_iterator{sentinel.nextChunk, 0};
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::iterator
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::end() {
+    return iterator{&sentinel, 0};
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  typename BasicChunkedSoA<ChunkSize, Allocator, Ts...>::const_iterator
+  BasicChunkedSoA<ChunkSize, Allocator, Ts...>::end() const {
+    return const_iterator{&sentinel, 0};
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  size_t BasicChunkedSoA<ChunkSize, Allocator, Ts...>::size() const {
+    return element_count;
+  }
+
+  template<size_t ChunkSize, template<typename> typename Allocator, typename... Ts>
+  bool BasicChunkedSoA<ChunkSize, Allocator, Ts...>::empty() const {
+    return element_count == 0;
+  }
+} // namespace chunked_list
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+#include "../CompressedChunkedList.hpp"
+
+namespace chunked_list {
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  typename CompressedChunkedList<T, ChunkSize, Allocator>::FrozenBlock
+  CompressedChunkedList<T, ChunkSize, Allocator>::encode(const T *values) {
+    using SignedT = std::make_signed_t<T>;
+
+    std::array<UnsignedT, ChunkSize> offsets;
+    std::array<UnsignedT, ChunkSize> deltas;
+
+    const T minimum = *std::min_element(values, values + ChunkSize);
+    UnsignedT maxOffset = 0;
+
+    for (size_t i = 0; i < ChunkSize; ++i) {
+      offsets[i] = static_cast<UnsignedT>(static_cast<UnsignedT>(values[i]) - static_cast<UnsignedT>(minimum));
+      maxOffset = std::max(maxOffset, offsets[i]);
+    }
+
+    // Deltas wrap in the unsigned type, and are compared as signed so decreasing runs stay narrow
+    SignedT minDelta = 0;
+
+    for (size_t i = 1; i < ChunkSize; ++i) {
+      deltas[i - 1] = static_cast<UnsignedT>(static_cast<UnsignedT>(values[i]) - static_cast<UnsignedT>(values[i - 1]));
+      minDelta = i == 1 ? static_cast<SignedT>(deltas[0]) : std::min(minDelta, static_cast<SignedT>(deltas[i - 1]));
+    }
+
+    UnsignedT maxDeltaOffset = 0;
+
+    for (size_t i = 0; i + 1 < ChunkSize; ++i) {
+      deltas[i] = static_cast<UnsignedT>(deltas[i] - static_cast<UnsignedT>(minDelta));
+      maxDeltaOffset = std::max(maxDeltaOffset, deltas[i]);
+    }
+
+    const auto offsetWidth = static_cast<uint8_t>(std::bit_width(maxOffset));
+    const auto deltaWidth = static_cast<uint8_t>(std::bit_width(maxDeltaOffset));
+
+    FrozenBlock block;
+
+    if (deltaWidth < offsetWidth) {
+      block = FrozenBlock{Encoding::Delta, deltaWidth, static_cast<UnsignedT>(minDelta),
+                          static_cast<UnsignedT>(values[0]), {}};
+      pack(block.words, deltas.data(), ChunkSize - 1, deltaWidth);
+    } else {
+      block = FrozenBlock{Encoding::FrameOfReference, offsetWidth, static_cast<UnsignedT>(minimum), 0, {}};
+      pack(block.words, offsets.data(), ChunkSize, offsetWidth);
+    }
+
+    return block;
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  void CompressedChunkedList<T, ChunkSize, Allocator>::decode(const FrozenBlock &block, T *output) {
+    if (block.encoding == Encoding::FrameOfReference) {
+      for (size_t i = 0; i < ChunkSize; ++i) {
+        output[i] = static_cast<T>(static_cast<UnsignedT>(block.reference + unpack(block.words, i, block.bitWidth)));
+      }
+
+      return;
+    }
+
+    UnsignedT value = block.first;
+    output[0] = static_cast<T>(value);
+
+    for (size_t i = 1; i < ChunkSize; ++i) {
+      value = static_cast<UnsignedT>(value + block.reference + unpack(block.words, i - 1, block.bitWidth));
+      output[i] = static_cast<T>(value);
+    }
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  void CompressedChunkedList<T, ChunkSize, Allocator>::pack(std::vector<uint64_t> &words, const UnsignedT *offsets,
+                                                            const size_t count, const uint8_t bitWidth) {
+    words.assign((count * bitWidth + 63) / 64, 0);
+
+    // Blocks of equal values, or of a constant step, need no bits beyond their reference
+    if (bitWidth == 0) {
+      return;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+      const size_t bit = i * bitWidth;
+      const auto offset = static_cast<uint64_t>(offsets[i]);
+
+      words[bit / 64] |= offset << (bit % 64);
+
+      // An offset straddling two words has its high bits written to the start of the next word
+      if (bit % 64 + bitWidth > 64) {
+        words[bit / 64 + 1] |= offset >> (64 - bit % 64);
+      }
+    }
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  typename CompressedChunkedList<T, ChunkSize, Allocator>::UnsignedT
+  CompressedChunkedList<T, ChunkSize, Allocator>::unpack(const std::vector<uint64_t> &words, const size_t index,
+                                                         const uint8_t bitWidth) {
+    if (bitWidth == 0) {
+      return 0;
+    }
+
+    const size_t bit = index * bitWidth;
+    uint64_t offset = words[bit / 64] >> (bit % 64);
+
+    if (bit % 64 + bitWidth > 64) {
+      offset |= words[bit / 64 + 1] << (64 - bit % 64);
+    }
+
+    const uint64_t mask = bitWidth == 64 ? ~uint64_t{0} : (uint64_t{1} << bitWidth) - 1;
+    return static_cast<UnsignedT>(offset & mask);
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  void CompressedChunkedList<T, ChunkSize, Allocator>::push_back(const T value) {
+    hot.push_back(value);
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  void CompressedChunkedList<T, ChunkSize, Allocator>::pop_back() {
+    if (hot.empty()) {
+      std::array<T, ChunkSize> values;
+      decode(frozen.back(), values.data());
+      frozen.pop_back();
+
+      for (const T value : values) {
+        hot.push_back(value);
+      }
+    }
+
+    hot.pop_back();
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  void CompressedChunkedList<T, ChunkSize, Allocator>::clear() {
+    frozen.clear();
+    hot.clear();
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  T CompressedChunkedList<T, ChunkSize, Allocator>::operator[](const size_t index) const {
+    // Every frozen block holds exactly ChunkSize values, so the block holding an element follows from its index
+    if (index >= frozen.size() * ChunkSize) {
+      return hot[index - frozen.size() * ChunkSize];
+    }
+
+    const FrozenBlock &block = frozen[index / ChunkSize];
+    const size_t offset = index % ChunkSize;
+
+    if (block.encoding == Encoding::FrameOfReference) {
+      return static_cast<T>(static_cast<UnsignedT>(block.reference + unpack(block.words, offset, block.bitWidth)));
+    }
+
+    UnsignedT value = block.first;
+
+    for (size_t i = 0; i < offset; ++i) {
+      value = static_cast<UnsignedT>(value + block.reference + unpack(block.words, i, block.bitWidth));
+    }
+
+    return static_cast<T>(value);
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  void CompressedChunkedList<T, ChunkSize, Allocator>::freeze() {
+    using ChunkIterator = typename ChunkedListT::chunk_iterator;
+
+    // Only the back chunk of a list which is appended to and popped from can be partially filled
+    while (hot.template begin<ChunkIterator>() != --hot.template end<ChunkIterator>()) {
+      ChunkIterator front = hot.template begin<ChunkIterator>();
+      frozen.push_back(encode(front->data()));
+      hot.erase(front);
+    }
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  void CompressedChunkedList<T, ChunkSize, Allocator>::thaw() {
+    ChunkedListT thawed;
+    std::array<T, ChunkSize> values;
+
+    for (const FrozenBlock &block : frozen) {
+      decode(block, values.data());
+
+      for (const T value : values) {
+        thawed.push_back(value);
+      }
+    }
+
+    thawed.splice(hot);
+    hot = std::move(thawed);
+    frozen.clear();
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Function>
+  void CompressedChunkedList<T, ChunkSize, Allocator>::for_each_segment(Function function) const {
+    std::array<T, ChunkSize> values;
+
+    for (const FrozenBlock &block : frozen) {
+      decode(block, values.data());
+      function(static_cast<const T *>(values.data()), ChunkSize);
+    }
+
+    hot.for_each_segment(function);
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  size_t CompressedChunkedList<T, ChunkSize, Allocator>::size() const {
+    return frozen.size() * ChunkSize + hot.size();
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  bool CompressedChunkedList<T, ChunkSize, Allocator>::empty() const {
+    return frozen.empty() && hot.empty();
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  size_t CompressedChunkedList<T, ChunkSize, Allocator>::frozen_chunks() const {
+    return frozen.size();
+  }
+
+  template<utility::integer T, size_t ChunkSize, template<typename> typename Allocator>
+  MemoryUsage CompressedChunkedList<T, ChunkSize, Allocator>::memory_usage() const {
+    MemoryUsage usage = hot.memory_usage();
+    usage.chunks += frozen.size();
+    usage.used_bytes += frozen.size() * ChunkSize * sizeof(T);
+    usage.reserved_bytes += frozen.capacity() * sizeof(FrozenBlock);
+
+    for (const FrozenBlock &block : frozen) {
+      usage.reserved_bytes += block.words.capacity() * sizeof(uint64_t);
+    }
+
+    return usage;
+  }
+} // namespace chunked_list
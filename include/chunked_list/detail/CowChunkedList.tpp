@@ -0,0 +1,298 @@
+#pragma once
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+#include "../CowChunkedList.hpp"
+
+namespace chunked_list {
+  // ---------------------------------------------------------------------------------------------------------------------
+  // SharedChunk implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  T *CowChunkedList<T, ChunkSize, Allocator>::SharedChunk::data() {
+    return std::launder(reinterpret_cast<T *>(storage));
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  const T *CowChunkedList<T, ChunkSize, Allocator>::SharedChunk::data() const {
+    return std::launder(reinterpret_cast<const T *>(storage));
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------------
+  // CowChunkedList implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename CowChunkedList<T, ChunkSize, Allocator>::SharedChunk *
+  CowChunkedList<T, ChunkSize, Allocator>::allocate_chunk() {
+    SharedChunk *chunk = ChunkAllocatorTraits::allocate(chunk_allocator, 1);
+    return new (chunk) SharedChunk{};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename CowChunkedList<T, ChunkSize, Allocator>::SharedChunk *
+  CowChunkedList<T, ChunkSize, Allocator>::clone_chunk(const SharedChunk *chunk) {
+    SharedChunk *clone = allocate_chunk();
+
+    try {
+      std::uninitialized_copy_n(chunk->data(), chunk->count, clone->data());
+    } catch (...) {
+      std::destroy_at(clone);
+      ChunkAllocatorTraits::deallocate(chunk_allocator, clone, 1);
+      throw;
+    }
+
+    clone->count = chunk->count;
+    return clone;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void CowChunkedList<T, ChunkSize, Allocator>::release(SharedChunk *chunk) {
+    // The holder dropping the last reference must see every write made through the other holders
+    if (chunk->references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+      return;
+    }
+
+    std::destroy_n(chunk->data(), chunk->count);
+    std::destroy_at(chunk);
+    ChunkAllocatorTraits::deallocate(chunk_allocator, chunk, 1);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename CowChunkedList<T, ChunkSize, Allocator>::SharedChunk *
+  CowChunkedList<T, ChunkSize, Allocator>::unique_chunk(const size_t chunkIndex) {
+    SharedChunk *chunk = chunks[chunkIndex];
+
+    // Only this list can add references to its chunks, so a count of 1 can't rise while the chunk is mutated
+    if (chunk->references.load(std::memory_order_acquire) == 1) {
+      return chunk;
+    }
+
+    SharedChunk *clone = clone_chunk(chunk);
+    chunks[chunkIndex] = clone;
+    release(chunk);
+
+    return clone;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  CowChunkedList<T, ChunkSize, Allocator>::CowChunkedList(std::initializer_list<T> initializerList) {
+    for (const T &value : initializerList) {
+      push_back(value);
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  CowChunkedList<T, ChunkSize, Allocator>::CowChunkedList(const CowChunkedList &other) :
+      chunk_allocator{other.chunk_allocator}, element_count{other.element_count} {
+    chunks.reserve(other.chunks.size());
+
+    try {
+      for (SharedChunk *chunk : other.chunks) {
+        if (chunk->unshareable) {
+          chunks.push_back(clone_chunk(chunk));
+        } else {
+          chunk->references.fetch_add(1, std::memory_order_relaxed);
+          chunks.push_back(chunk);
+        }
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  CowChunkedList<T, ChunkSize, Allocator>::CowChunkedList(CowChunkedList &&other) noexcept :
+      chunk_allocator{std::move(other.chunk_allocator)}, chunks{std::move(other.chunks)},
+      element_count{std::exchange(other.element_count, 0)} {
+    other.chunks.clear();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  CowChunkedList<T, ChunkSize, Allocator> &CowChunkedList<T, ChunkSize, Allocator>::operator=(
+    const CowChunkedList &other) {
+    if (this != &other) {
+      CowChunkedList copy{other};
+      operator=(std::move(copy));
+    }
+
+    return *this;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  CowChunkedList<T, ChunkSize, Allocator> &CowChunkedList<T, ChunkSize, Allocator>::operator=(
+    CowChunkedList &&other) noexcept {
+    if (this != &other) {
+      // The chunks of this list are released through its own allocator before it takes the other's
+      clear();
+      chunk_allocator = std::move(other.chunk_allocator);
+      chunks = std::move(other.chunks);
+      element_count = std::exchange(other.element_count, 0);
+      other.chunks.clear();
+    }
+
+    return *this;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  CowChunkedList<T, ChunkSize, Allocator>::~CowChunkedList() {
+    clear();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  CowChunkedList<T, ChunkSize, Allocator> CowChunkedList<T, ChunkSize, Allocator>::snapshot() const {
+    return CowChunkedList{*this};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  T &CowChunkedList<T, ChunkSize, Allocator>::operator[](const size_t index) {
+    // Every chunk but the back one is full, so the chunk holding an element follows from its index
+    SharedChunk *chunk = unique_chunk(index / ChunkSize);
+    chunk->unshareable = true;
+    return chunk->data()[index % ChunkSize];
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  const T &CowChunkedList<T, ChunkSize, Allocator>::operator[](const size_t index) const {
+    return chunks[index / ChunkSize]->data()[index % ChunkSize];
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void CowChunkedList<T, ChunkSize, Allocator>::push_back(const T &value) {
+    construct_back(value);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void CowChunkedList<T, ChunkSize, Allocator>::push_back(T &&value) {
+    construct_back(std::move(value));
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename... Args>
+  T &CowChunkedList<T, ChunkSize, Allocator>::emplace_back(Args &&...args) {
+    SharedChunk *back = construct_back(std::forward<Args>(args)...);
+    back->unshareable = true;
+    return back->data()[back->count - 1];
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename... Args>
+  typename CowChunkedList<T, ChunkSize, Allocator>::SharedChunk *
+  CowChunkedList<T, ChunkSize, Allocator>::construct_back(Args &&...args) {
+    SharedChunk *back;
+
+    if (element_count % ChunkSize == 0) {
+      // Room for the pointer is made before allocate_chunk, so the catch below is the only place a fresh chunk has to
+      // be released, and doubling the reservation keeps the reallocations of the vector amortized
+      if (chunks.size() == chunks.capacity()) {
+        chunks.reserve(std::max<size_t>(1, chunks.capacity() * 2));
+      }
+
+      back = allocate_chunk();
+      chunks.push_back(back);
+    } else {
+      back = unique_chunk(chunks.size() - 1);
+    }
+
+    try {
+      std::construct_at(back->data() + back->count, std::forward<Args>(args)...);
+    } catch (...) {
+      if (back->count == 0) {
+        chunks.pop_back();
+        release(back);
+      }
+
+      throw;
+    }
+
+    ++back->count;
+    ++element_count;
+    return back;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void CowChunkedList<T, ChunkSize, Allocator>::pop_back() {
+    SharedChunk *back = chunks.back();
+
+    if (back->count == 1) {
+      // The whole chunk goes, so a shared one is only released rather than cloned
+      chunks.pop_back();
+      release(back);
+    } else {
+      back = unique_chunk(chunks.size() - 1);
+      std::destroy_at(back->data() + --back->count);
+    }
+
+    --element_count;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void CowChunkedList<T, ChunkSize, Allocator>::clear() {
+    for (SharedChunk *chunk : chunks) {
+      release(chunk);
+    }
+
+    chunks.clear();
+    element_count = 0;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename CowChunkedList<T, ChunkSize, Allocator>::iterator CowChunkedList<T, ChunkSize, Allocator>::begin() {
+    return iterator{this, 0};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename CowChunkedList<T, ChunkSize, Allocator>::const_iterator
+  CowChunkedList<T, ChunkSize, Allocator>::begin() const {
+    return const_iterator{this, 0};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename CowChunkedList<T, ChunkSize, Allocator>::const_iterator
+  CowChunkedList<T, ChunkSize, Allocator>::cbegin() const {
+    return begin();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename CowChunkedList<T, ChunkSize, Allocator>::iterator CowChunkedList<T, ChunkSize, Allocator>::end() {
+    return iterator{this, element_count};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename CowChunkedList<T, ChunkSize, Allocator>::const_iterator
+  CowChunkedList<T, ChunkSize, Allocator>::end() const {
+    return const_iterator{this, element_count};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename CowChunkedList<T, ChunkSize, Allocator>::const_iterator
+  CowChunkedList<T, ChunkSize, Allocator>::cend() const {
+    return end();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  size_t CowChunkedList<T, ChunkSize, Allocator>::size() const {
+    return element_count;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  bool CowChunkedList<T, ChunkSize, Allocator>::empty() const {
+    return element_count == 0;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  size_t CowChunkedList<T, ChunkSize, Allocator>::shared_chunks() const {
+    return static_cast<size_t>(std::count_if(chunks.begin(), chunks.end(), [](const SharedChunk *chunk) {
+      return chunk->references.load(std::memory_order_relaxed) > 1;
+    }));
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  bool CowChunkedList<T, ChunkSize, Allocator>::operator==(const CowChunkedList &other) const {
+    return std::equal(begin(), end(), other.begin(), other.end());
+  }
+} // namespace chunked_list
@@ -0,0 +1,261 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+
+#include "../GeometricChunkedList.hpp"
+
+namespace chunked_list {
+  // ---------------------------------------------------------------------------------------------------------------------
+  // GeometricChunkedList implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  typename GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::Position
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::locate(const size_t index) {
+    if (index < growing_elements) {
+      // The chunks before ordinal k hold FirstChunkSize * (2^k - 1) elements, so k is one less than the bit width of
+      // index / FirstChunkSize + 1
+      const auto ordinal = static_cast<size_t>(std::bit_width(index / FirstChunkSize + 1) - 1);
+      return Position{ordinal, index - FirstChunkSize * ((size_t{1} << ordinal) - 1)};
+    }
+
+    const size_t beyond = index - growing_elements;
+    return Position{growing_chunks + beyond / MaxChunkSize, beyond % MaxChunkSize};
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  void GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::release() {
+    size_t remaining = element_count;
+
+    for (size_t ordinal = 0; ordinal < chunks.size(); ++ordinal) {
+      const size_t count = std::min(remaining, chunk_capacity(ordinal));
+      std::destroy_n(chunks[ordinal], count);
+      ValueAllocatorTraits::deallocate(value_allocator, chunks[ordinal], chunk_capacity(ordinal));
+      remaining -= count;
+    }
+
+    chunks.clear();
+    element_count = 0;
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::GeometricChunkedList(
+    std::initializer_list<T> initializerList) {
+    for (const T &value : initializerList) {
+      push_back(value);
+    }
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::GeometricChunkedList(
+    const GeometricChunkedList &other) :
+      value_allocator{ValueAllocatorTraits::select_on_container_copy_construction(other.value_allocator)} {
+    chunks.reserve(other.chunks.size());
+
+    try {
+      other.for_each_segment([this](const T *data, const size_t size) {
+        for (size_t offset = 0; offset < size; ++offset) {
+          emplace_back(data[offset]);
+        }
+      });
+    } catch (...) {
+      release();
+      throw;
+    }
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::GeometricChunkedList(
+    GeometricChunkedList &&other) noexcept :
+      value_allocator{std::move(other.value_allocator)}, chunks{std::move(other.chunks)},
+      element_count{std::exchange(other.element_count, 0)} {
+    other.chunks.clear();
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator> &
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::operator=(const GeometricChunkedList &other) {
+    if (this != &other) {
+      GeometricChunkedList copy{other};
+      operator=(std::move(copy));
+    }
+
+    return *this;
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator> &
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::operator=(GeometricChunkedList &&other) noexcept {
+    if (this != &other) {
+      release();
+      value_allocator = std::move(other.value_allocator);
+      chunks = std::move(other.chunks);
+      element_count = std::exchange(other.element_count, 0);
+      other.chunks.clear();
+    }
+
+    return *this;
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::~GeometricChunkedList() {
+    release();
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  constexpr size_t GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::chunk_capacity(
+    const size_t ordinal) {
+    return ordinal < growing_chunks ? FirstChunkSize << ordinal : MaxChunkSize;
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  T &GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::operator[](const size_t index) {
+    const Position position = locate(index);
+    return chunks[position.chunk][position.offset];
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  const T &GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::operator[](const size_t index) const {
+    const Position position = locate(index);
+    return chunks[position.chunk][position.offset];
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  void GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::push_back(const T &value) {
+    emplace_back(value);
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  void GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::push_back(T &&value) {
+    emplace_back(std::move(value));
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  template<typename... Args>
+  T &GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::emplace_back(Args &&...args) {
+    // Every chunk before the back one is full, so an element starting a chunk needs a new one
+    const Position position = locate(element_count);
+
+    if (position.offset == 0) {
+      // The chunk is allocated within the push_back call, which must then not reallocate and throw, or the chunk would
+      // leak. Since reserve may allocate no more than it is asked for, it is asked for twice the capacity
+      if (chunks.size() == chunks.capacity()) {
+        chunks.reserve(std::max<size_t>(1, chunks.capacity() * 2));
+      }
+
+      chunks.push_back(ValueAllocatorTraits::allocate(value_allocator, chunk_capacity(position.chunk)));
+    }
+
+    T *slot = chunks[position.chunk] + position.offset;
+
+    try {
+      ValueAllocatorTraits::construct(value_allocator, slot, std::forward<Args>(args)...);
+    } catch (...) {
+      if (position.offset == 0) {
+        ValueAllocatorTraits::deallocate(value_allocator, chunks.back(), chunk_capacity(position.chunk));
+        chunks.pop_back();
+      }
+
+      throw;
+    }
+
+    ++element_count;
+    return *slot;
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  void GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::pop_back() {
+    const Position position = locate(--element_count);
+    std::destroy_at(chunks[position.chunk] + position.offset);
+
+    if (position.offset == 0) {
+      ValueAllocatorTraits::deallocate(value_allocator, chunks.back(), chunk_capacity(position.chunk));
+      chunks.pop_back();
+    }
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  void GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::clear() {
+    release();
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  typename GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::iterator
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::begin() {
+    return iterator{this, 0};
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  typename GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::const_iterator
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::begin() const {
+    return const_iterator{this, 0};
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  typename GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::const_iterator
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::cbegin() const {
+    return begin();
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  typename GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::iterator
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::end() {
+    return iterator{this, element_count};
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  typename GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::const_iterator
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::end() const {
+    return const_iterator{this, element_count};
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  typename GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::const_iterator
+  GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::cend() const {
+    return end();
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  template<typename Function>
+  void GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::for_each_segment(Function function) const {
+    size_t remaining = element_count;
+
+    for (size_t ordinal = 0; ordinal < chunks.size(); ++ordinal) {
+      const size_t count = std::min(remaining, chunk_capacity(ordinal));
+      function(static_cast<const T *>(chunks[ordinal]), count);
+      remaining -= count;
+    }
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  size_t GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::size() const {
+    return element_count;
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  bool GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::empty() const {
+    return element_count == 0;
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  size_t GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::capacity() const {
+    if (chunks.size() <= growing_chunks) {
+      return FirstChunkSize * ((size_t{1} << chunks.size()) - 1);
+    }
+
+    return growing_elements + (chunks.size() - growing_chunks) * MaxChunkSize;
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  MemoryUsage GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::memory_usage() const {
+    return MemoryUsage{chunks.size(), element_count * sizeof(T),
+                       capacity() * sizeof(T) + chunks.capacity() * sizeof(T *)};
+  }
+
+  template<typename T, size_t FirstChunkSize, size_t MaxChunkSize, template<typename> typename Allocator>
+  bool GeometricChunkedList<T, FirstChunkSize, MaxChunkSize, Allocator>::operator==(
+    const GeometricChunkedList &other) const {
+    return std::equal(begin(), end(), other.begin(), other.end());
+  }
+} // namespace chunked_list
@@ -0,0 +1,386 @@
+#pragma once
+
+#include <bit>
+#include <functional>
+#include <new>
+#include <utility>
+
+#include "../HiveChunkedList.hpp"
+
+namespace chunked_list {
+  // ---------------------------------------------------------------------------------------------------------------------
+  // HiveChunk implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  T *HiveChunkedList<T, ChunkSize, Allocator>::HiveChunk::data() {
+    return std::launder(reinterpret_cast<T *>(storage));
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  const T *HiveChunkedList<T, ChunkSize, Allocator>::HiveChunk::data() const {
+    return std::launder(reinterpret_cast<const T *>(storage));
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  size_t HiveChunkedList<T, ChunkSize, Allocator>::HiveChunk::next_occupied(const size_t slot) const {
+    if (slot >= ChunkSize) {
+      return ChunkSize;
+    }
+
+    // The bits of the slots before the given one are masked off, then every later word is scanned whole
+    std::uint64_t bits = occupied[slot / 64] & (~std::uint64_t{0} << (slot % 64));
+
+    for (size_t word = slot / 64;;) {
+      if (bits != 0) {
+        return word * 64 + static_cast<size_t>(std::countr_zero(bits));
+      }
+
+      if (++word == skipfield_words) {
+        return ChunkSize;
+      }
+
+      bits = occupied[word];
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  size_t HiveChunkedList<T, ChunkSize, Allocator>::HiveChunk::first_vacant() const {
+    size_t word = 0;
+
+    while (occupied[word] == ~std::uint64_t{0}) {
+      ++word;
+    }
+
+    return word * 64 + static_cast<size_t>(std::countr_one(occupied[word]));
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------------
+  // generic_iterator implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  HiveChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::generic_iterator(ChunkT *chunk,
+                                                                                        const size_t slot) :
+      chunk{chunk}, slot{slot} {}
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  HiveChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator generic_iterator<false>() const
+    requires Mutable
+  {
+    return generic_iterator<false>{chunk, slot};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>::ValueT &
+  HiveChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator*() const {
+    return chunk->data()[slot];
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>::ValueT *
+  HiveChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator->() const {
+    return chunk->data() + slot;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable> &
+  HiveChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator++() {
+    slot = chunk->next_occupied(slot + 1);
+
+    // Empty chunks are deallocated, so the first occupied slot of the next chunk is always found
+    if (slot == ChunkSize) {
+      chunk = chunk->nextChunk;
+      slot = chunk ? chunk->next_occupied(0) : 0;
+    }
+
+    return *this;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>
+  HiveChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator++(int) {
+    generic_iterator original = *this;
+    ++*this;
+    return original;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  bool HiveChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator==(
+    const generic_iterator &other) const {
+    return chunk == other.chunk && slot == other.slot;
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------------
+  // HiveChunkedList implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void HiveChunkedList<T, ChunkSize, Allocator>::link_vacant(HiveChunk *chunk) {
+    chunk->prevVacant = nullptr;
+    chunk->nextVacant = vacant_chunks;
+
+    if (vacant_chunks) {
+      vacant_chunks->prevVacant = chunk;
+    }
+
+    vacant_chunks = chunk;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void HiveChunkedList<T, ChunkSize, Allocator>::unlink_vacant(HiveChunk *chunk) {
+    if (chunk->prevVacant) {
+      chunk->prevVacant->nextVacant = chunk->nextVacant;
+    } else {
+      vacant_chunks = chunk->nextVacant;
+    }
+
+    if (chunk->nextVacant) {
+      chunk->nextVacant->prevVacant = chunk->prevVacant;
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void HiveChunkedList<T, ChunkSize, Allocator>::deallocate_chunk(HiveChunk *chunk) {
+    unlink_vacant(chunk);
+
+    (chunk->prevChunk ? chunk->prevChunk->nextChunk : front_chunk) = chunk->nextChunk;
+    (chunk->nextChunk ? chunk->nextChunk->prevChunk : back_chunk) = chunk->prevChunk;
+
+    std::destroy_at(chunk);
+    ChunkAllocatorTraits::deallocate(chunk_allocator, chunk, 1);
+    --chunk_count;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  HiveChunkedList<T, ChunkSize, Allocator>::HiveChunkedList(std::initializer_list<T> initializerList) {
+    for (const T &value : initializerList) {
+      insert(value);
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  HiveChunkedList<T, ChunkSize, Allocator>::HiveChunkedList(const HiveChunkedList &other) :
+      chunk_allocator{other.chunk_allocator} {
+    try {
+      for (const T &value : other) {
+        insert(value);
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  HiveChunkedList<T, ChunkSize, Allocator>::HiveChunkedList(HiveChunkedList &&other) noexcept :
+      chunk_allocator{std::move(other.chunk_allocator)}, front_chunk{std::exchange(other.front_chunk, nullptr)},
+      back_chunk{std::exchange(other.back_chunk, nullptr)}, vacant_chunks{std::exchange(other.vacant_chunks, nullptr)},
+      chunk_count{std::exchange(other.chunk_count, 0)}, element_count{std::exchange(other.element_count, 0)} {}
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  HiveChunkedList<T, ChunkSize, Allocator> &HiveChunkedList<T, ChunkSize, Allocator>::operator=(
+    const HiveChunkedList &other) {
+    if (this != &other) {
+      HiveChunkedList copy{other};
+      operator=(std::move(copy));
+    }
+
+    return *this;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  HiveChunkedList<T, ChunkSize, Allocator> &HiveChunkedList<T, ChunkSize, Allocator>::operator=(
+    HiveChunkedList &&other) noexcept {
+    if (this != &other) {
+      clear();
+      front_chunk = std::exchange(other.front_chunk, nullptr);
+      back_chunk = std::exchange(other.back_chunk, nullptr);
+      vacant_chunks = std::exchange(other.vacant_chunks, nullptr);
+      chunk_count = std::exchange(other.chunk_count, 0);
+      element_count = std::exchange(other.element_count, 0);
+    }
+
+    return *this;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  HiveChunkedList<T, ChunkSize, Allocator>::~HiveChunkedList() {
+    clear();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::iterator
+  HiveChunkedList<T, ChunkSize, Allocator>::insert(const T &value) {
+    return emplace(value);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::iterator
+  HiveChunkedList<T, ChunkSize, Allocator>::insert(T &&value) {
+    return emplace(std::move(value));
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename... Args>
+    requires utility::can_construct<T, Args...>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::iterator
+  HiveChunkedList<T, ChunkSize, Allocator>::emplace(Args &&...args) {
+    HiveChunk *chunk = vacant_chunks;
+
+    if (!chunk) {
+      chunk = ChunkAllocatorTraits::allocate(chunk_allocator, 1);
+      new (chunk) HiveChunk{};
+
+      chunk->prevChunk = back_chunk;
+      (back_chunk ? back_chunk->nextChunk : front_chunk) = chunk;
+      back_chunk = chunk;
+
+      link_vacant(chunk);
+      ++chunk_count;
+    }
+
+    const size_t slot = chunk->first_vacant();
+
+    try {
+      std::construct_at(chunk->data() + slot, std::forward<Args>(args)...);
+    } catch (...) {
+      if (chunk->count == 0) {
+        deallocate_chunk(chunk);
+      }
+
+      throw;
+    }
+
+    chunk->occupied[slot / 64] |= std::uint64_t{1} << (slot % 64);
+    ++element_count;
+
+    if (++chunk->count == ChunkSize) {
+      unlink_vacant(chunk);
+    }
+
+    return iterator{chunk, slot};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::iterator
+  HiveChunkedList<T, ChunkSize, Allocator>::erase(const const_iterator it) {
+    // The iterator references an element of this list, so its chunk can be mutated
+    auto *chunk = const_cast<HiveChunk *>(it.chunk);
+    const size_t slot = it.slot;
+
+    iterator next{chunk, slot};
+    ++next;
+
+    std::destroy_at(chunk->data() + slot);
+    chunk->occupied[slot / 64] &= ~(std::uint64_t{1} << (slot % 64));
+    --element_count;
+
+    if (chunk->count-- == ChunkSize) {
+      link_vacant(chunk);
+    }
+
+    if (chunk->count == 0) {
+      deallocate_chunk(chunk);
+    }
+
+    return next;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::iterator
+  HiveChunkedList<T, ChunkSize, Allocator>::get_iterator(const T *pointer) {
+    // Pointers into different chunks are unrelated, so only std::less orders them
+    const std::less<const T *> less;
+
+    for (HiveChunk *chunk = front_chunk; chunk; chunk = chunk->nextChunk) {
+      if (!less(pointer, chunk->data()) && less(pointer, chunk->data() + ChunkSize)) {
+        return iterator{chunk, static_cast<size_t>(pointer - chunk->data())};
+      }
+    }
+
+    return end();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::const_iterator
+  HiveChunkedList<T, ChunkSize, Allocator>::get_iterator(const T *pointer) const {
+    return const_cast<HiveChunkedList *>(this)->get_iterator(pointer);
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  void HiveChunkedList<T, ChunkSize, Allocator>::clear() {
+    while (front_chunk) {
+      HiveChunk *chunk = front_chunk;
+
+      for (size_t slot = chunk->next_occupied(0); slot != ChunkSize; slot = chunk->next_occupied(slot + 1)) {
+        std::destroy_at(chunk->data() + slot);
+      }
+
+      front_chunk = chunk->nextChunk;
+      std::destroy_at(chunk);
+      ChunkAllocatorTraits::deallocate(chunk_allocator, chunk, 1);
+    }
+
+    back_chunk = nullptr;
+    vacant_chunks = nullptr;
+    chunk_count = 0;
+    element_count = 0;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::iterator HiveChunkedList<T, ChunkSize, Allocator>::begin() {
+    return front_chunk ? iterator{front_chunk, front_chunk->next_occupied(0)} : end();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::const_iterator
+  HiveChunkedList<T, ChunkSize, Allocator>::begin() const {
+    return front_chunk ? const_iterator{front_chunk, front_chunk->next_occupied(0)} : end();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::const_iterator
+  HiveChunkedList<T, ChunkSize, Allocator>::cbegin() const {
+    return begin();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::iterator HiveChunkedList<T, ChunkSize, Allocator>::end() {
+    return iterator{nullptr, 0};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::const_iterator
+  HiveChunkedList<T, ChunkSize, Allocator>::end() const {
+    return const_iterator{nullptr, 0};
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  typename HiveChunkedList<T, ChunkSize, Allocator>::const_iterator
+  HiveChunkedList<T, ChunkSize, Allocator>::cend() const {
+    return end();
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  size_t HiveChunkedList<T, ChunkSize, Allocator>::size() const {
+    return element_count;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  bool HiveChunkedList<T, ChunkSize, Allocator>::empty() const {
+    return element_count == 0;
+  }
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  MemoryUsage HiveChunkedList<T, ChunkSize, Allocator>::memory_usage() const {
+    return MemoryUsage{chunk_count, element_count * sizeof(T), chunk_count * sizeof(HiveChunk)};
+  }
+} // namespace chunked_list
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace chunked_list {
+  /**
+   * @brief A random access iterator over the elements of a list by index, dereferencing through the list's own
+   * operator[], for lists which find an element from its index without walking their chunks
+   * @tparam ListType The type of list iterated through, which must provide value_type and operator[]
+   * @tparam Mutable Whether the element referenced by the iterator can be mutated, through the non-const operator[]
+   */
+  template<typename ListType, bool Mutable>
+  class IndexIterator {
+      friend ListType;
+
+      using ListT = std::conditional_t<Mutable, ListType, const ListType>;
+
+      ListT *list{nullptr};
+      size_t index{0};
+
+      IndexIterator(ListT *list, size_t index);
+
+    public:
+      using value_type = typename ListType::value_type;
+      using reference = std::conditional_t<Mutable, value_type, const value_type> &;
+      using pointer = std::conditional_t<Mutable, value_type, const value_type> *;
+      using difference_type = std::ptrdiff_t;
+      using iterator_category = std::random_access_iterator_tag;
+      using iterator_concept = std::random_access_iterator_tag;
+
+      IndexIterator() = default;
+
+      reference operator*() const;
+
+      pointer operator->() const;
+
+      reference operator[](difference_type n) const;
+
+      IndexIterator &operator++();
+
+      IndexIterator operator++(int);
+
+      IndexIterator &operator--();
+
+      IndexIterator operator--(int);
+
+      IndexIterator &operator+=(difference_type n);
+
+      IndexIterator &operator-=(difference_type n);
+
+      IndexIterator operator+(difference_type n) const;
+
+      friend IndexIterator operator+(difference_type n, const IndexIterator &it) { return it + n; }
+
+      IndexIterator operator-(difference_type n) const;
+
+      difference_type operator-(const IndexIterator &other) const;
+
+      bool operator==(const IndexIterator &other) const;
+
+      std::strong_ordering operator<=>(const IndexIterator &other) const;
+  };
+} // namespace chunked_list
+
+#include "IndexIterator.tpp"
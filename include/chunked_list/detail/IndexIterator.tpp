@@ -0,0 +1,88 @@
+#pragma once
+
+#include "IndexIterator.hpp"
+
+namespace chunked_list {
+  template<typename ListType, bool Mutable>
+  IndexIterator<ListType, Mutable>::IndexIterator(ListT *list, const size_t index) : list{list}, index{index} {}
+
+  template<typename ListType, bool Mutable>
+  typename IndexIterator<ListType, Mutable>::reference IndexIterator<ListType, Mutable>::operator*() const {
+    return (*list)[index];
+  }
+
+  template<typename ListType, bool Mutable>
+  typename IndexIterator<ListType, Mutable>::pointer IndexIterator<ListType, Mutable>::operator->() const {
+    return &(*list)[index];
+  }
+
+  template<typename ListType, bool Mutable>
+  typename IndexIterator<ListType, Mutable>::reference
+  IndexIterator<ListType, Mutable>::operator[](const difference_type n) const {
+    return (*list)[index + n];
+  }
+
+  template<typename ListType, bool Mutable>
+  IndexIterator<ListType, Mutable> &IndexIterator<ListType, Mutable>::operator++() {
+    ++index;
+    return *this;
+  }
+
+  template<typename ListType, bool Mutable>
+  IndexIterator<ListType, Mutable> IndexIterator<ListType, Mutable>::operator++(int) {
+    IndexIterator original = *this;
+    ++index;
+    return original;
+  }
+
+  template<typename ListType, bool Mutable>
+  IndexIterator<ListType, Mutable> &IndexIterator<ListType, Mutable>::operator--() {
+    --index;
+    return *this;
+  }
+
+  template<typename ListType, bool Mutable>
+  IndexIterator<ListType, Mutable> IndexIterator<ListType, Mutable>::operator--(int) {
+    IndexIterator original = *this;
+    --index;
+    return original;
+  }
+
+  template<typename ListType, bool Mutable>
+  IndexIterator<ListType, Mutable> &IndexIterator<ListType, Mutable>::operator+=(const difference_type n) {
+    index += n;
+    return *this;
+  }
+
+  template<typename ListType, bool Mutable>
+  IndexIterator<ListType, Mutable> &IndexIterator<ListType, Mutable>::operator-=(const difference_type n) {
+    index -= n;
+    return *this;
+  }
+
+  template<typename ListType, bool Mutable>
+  IndexIterator<ListType, Mutable> IndexIterator<ListType, Mutable>::operator+(const difference_type n) const {
+    return IndexIterator{list, index + n};
+  }
+
+  template<typename ListType, bool Mutable>
+  IndexIterator<ListType, Mutable> IndexIterator<ListType, Mutable>::operator-(const difference_type n) const {
+    return IndexIterator{list, index - n};
+  }
+
+  template<typename ListType, bool Mutable>
+  typename IndexIterator<ListType, Mutable>::difference_type
+  IndexIterator<ListType, Mutable>::operator-(const IndexIterator &other) const {
+    return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+  }
+
+  template<typename ListType, bool Mutable>
+  bool IndexIterator<ListType, Mutable>::operator==(const IndexIterator &other) const {
+    return index == other.index;
+  }
+
+  template<typename ListType, bool Mutable>
+  std::strong_ordering IndexIterator<ListType, Mutable>::operator<=>(const IndexIterator &other) const {
+    return index <=> other.index;
+  }
+} // namespace chunked_list
@@ -0,0 +1,317 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#include "../MappedChunkedList.hpp"
+
+namespace chunked_list {
+  // ---------------------------------------------------------------------------------------------------------------------
+  // MappedArena implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  inline MappedArena::MappedArena(const std::string &path, const MappedAccess access, const size_t reservation) :
+      isWritable{access == MappedAccess::ReadWrite}, reserved{reservation} {
+    fd = ::open(path.c_str(), isWritable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+
+    if (fd < 0) {
+      throw std::runtime_error(utility::concatenate("Failed to open ", path, '!'));
+    }
+
+    try {
+      struct stat status{};
+
+      if (::fstat(fd, &status) != 0) {
+        throw std::runtime_error(utility::concatenate("Failed to stat ", path, '!'));
+      }
+
+      const size_t fileSize = static_cast<size_t>(status.st_size);
+
+      Header existing{};
+
+      if (fileSize != 0) {
+        if (fileSize < sizeof(Header) || ::pread(fd, &existing, sizeof(Header), 0) != sizeof(Header) ||
+            std::memcmp(existing.magic, Header{}.magic, sizeof(existing.magic)) != 0 ||
+            existing.version != Header{}.version) {
+          throw std::runtime_error(utility::concatenate(path, " is not a mapped chunked list file!"));
+        }
+
+        if (fileSize > reserved) {
+          throw std::runtime_error(utility::concatenate(path, " is larger than the reserved address space!"));
+        }
+      }
+
+      // Reserving the address space at the previous base avoids relocating the chunk pointers in the common case
+      auto *hint = reinterpret_cast<void *>(static_cast<uintptr_t>(existing.base));
+      int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+
+#ifdef MAP_FIXED_NOREPLACE
+      if (hint) {
+        flags |= MAP_FIXED_NOREPLACE;
+      }
+#endif
+
+      void *reservedPtr = ::mmap(hint, reserved, PROT_NONE, flags, -1, 0);
+
+      if (reservedPtr == MAP_FAILED && hint) {
+        reservedPtr = ::mmap(nullptr, reserved, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+      }
+
+      if (reservedPtr == MAP_FAILED) {
+        throw std::bad_alloc{};
+      }
+
+      mapping = static_cast<std::byte *>(reservedPtr);
+
+      if (fileSize == 0) {
+        if (!isWritable) {
+          throw std::runtime_error(utility::concatenate(path, " is empty and can not be created read-only!"));
+        }
+
+        wasCreated = true;
+        grow(sizeof(Header));
+        new (mapping) Header{};
+      } else {
+        const int mapFlags = (isWritable ? MAP_SHARED : MAP_PRIVATE) | MAP_FIXED;
+
+        if (::mmap(mapping, fileSize, PROT_READ | PROT_WRITE, mapFlags, fd, 0) == MAP_FAILED) {
+          throw std::runtime_error(utility::concatenate("Failed to map ", path, '!'));
+        }
+
+        mapped = fileSize;
+        previousBase = reinterpret_cast<std::byte *>(static_cast<uintptr_t>(existing.base));
+      }
+
+      header().base = reinterpret_cast<uintptr_t>(mapping);
+    } catch (...) {
+      if (mapping) {
+        ::munmap(mapping, reserved);
+      }
+
+      ::close(fd);
+      throw;
+    }
+  }
+
+  inline MappedArena::~MappedArena() {
+    ::munmap(mapping, reserved);
+    ::close(fd);
+  }
+
+  inline bool MappedArena::created() const { return wasCreated; }
+
+  inline bool MappedArena::writable() const { return isWritable; }
+
+  inline std::byte *MappedArena::previous_base() const { return previousBase; }
+
+  inline std::byte *MappedArena::base() const { return mapping; }
+
+  inline MappedArena::Header &MappedArena::header() { return *std::launder(reinterpret_cast<Header *>(mapping)); }
+
+  inline const MappedArena::Header &MappedArena::header() const {
+    return *std::launder(reinterpret_cast<const Header *>(mapping));
+  }
+
+  inline void *MappedArena::initialize(const size_t rootSize, const size_t rootAlignment, const size_t blockSize,
+                                       const size_t blockAlignment) {
+    Header &fileHeader = header();
+    fileHeader.root_offset = utility::align_up(sizeof(Header), rootAlignment);
+    fileHeader.block_size = utility::align_up(blockSize, blockAlignment);
+    fileHeader.used = utility::align_up(fileHeader.root_offset + rootSize, blockAlignment);
+
+    grow(fileHeader.used);
+
+    return root();
+  }
+
+  inline void *MappedArena::root() const { return mapping + header().root_offset; }
+
+  inline void *MappedArena::allocate_block() {
+    if (!isWritable) {
+      throw std::runtime_error("Chunks can not be allocated in a read-only mapped file!");
+    }
+
+    Header &fileHeader = header();
+
+    if (fileHeader.free_head != 0) {
+      std::byte *block = mapping + fileHeader.free_head;
+      std::memcpy(&fileHeader.free_head, block, sizeof(fileHeader.free_head));
+      return block;
+    }
+
+    if (fileHeader.used + fileHeader.block_size > mapped) {
+      grow(fileHeader.used + fileHeader.block_size);
+    }
+
+    std::byte *block = mapping + fileHeader.used;
+    fileHeader.used += fileHeader.block_size;
+    return block;
+  }
+
+  inline void MappedArena::deallocate_block(void *block) {
+    Header &fileHeader = header();
+    const std::uint64_t offset = static_cast<std::byte *>(block) - mapping;
+
+    std::memcpy(block, &fileHeader.free_head, sizeof(fileHeader.free_head));
+    fileHeader.free_head = offset;
+  }
+
+  inline void MappedArena::sync() const {
+    if (isWritable && ::msync(mapping, mapped, MS_SYNC) != 0) {
+      throw std::runtime_error("Failed to sync mapped file!");
+    }
+  }
+
+  inline size_t MappedArena::mapped_size() const { return mapped; }
+
+  inline void MappedArena::grow(const size_t minimumSize) {
+    const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const size_t newSize = utility::align_up(std::max(minimumSize, mapped * 2), pageSize);
+
+    if (newSize > reserved) {
+      throw std::bad_alloc{};
+    }
+
+    if (::ftruncate(fd, static_cast<off_t>(newSize)) != 0) {
+      throw std::runtime_error("Failed to grow mapped file!");
+    }
+
+    // The file is shared, so remapping the whole of it in place keeps every page which has already been written to
+    if (::mmap(mapping, newSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+      throw std::runtime_error("Failed to map grown file!");
+    }
+
+    mapped = newSize;
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------------
+  // MappedAllocator implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<typename T>
+  MappedAllocator<T>::MappedAllocator(MappedArena &arena) : arena{&arena} {}
+
+  template<typename T>
+  template<typename U>
+  MappedAllocator<T>::MappedAllocator(const MappedAllocator<U> &other) : arena{other.arena} {}
+
+  template<typename T>
+  T *MappedAllocator<T>::allocate(const size_t n) {
+    if (!arena || n * sizeof(T) > arena->header().block_size) {
+      throw std::bad_alloc{};
+    }
+
+    return static_cast<T *>(arena->allocate_block());
+  }
+
+  template<typename T>
+  void MappedAllocator<T>::deallocate(T *ptr, size_t) {
+    arena->deallocate_block(ptr);
+  }
+
+  template<typename T>
+  template<typename U>
+  bool MappedAllocator<T>::operator==(const MappedAllocator<U> &other) const {
+    return arena == other.arena;
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------------
+  // MappedChunkedList implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<typename T, size_t ChunkSize>
+  MappedChunkedList<T, ChunkSize>::MappedChunkedList(const std::string &path, const MappedAccess access,
+                                                     const size_t reservation) : arena{path, access, reservation} {
+    MappedArena::Header &header = arena.header();
+
+    if (arena.created()) {
+      header.value_size = sizeof(T);
+      header.chunk_size = ChunkSize;
+
+      void *storage = arena.initialize(sizeof(list_type), alignof(list_type), sizeof(Chunk), alignof(Chunk));
+      listPtr = new (storage) list_type{MappedAllocator<Chunk>{arena}};
+      return;
+    }
+
+    if (header.value_size != sizeof(T) || header.chunk_size != ChunkSize || header.block_size < sizeof(Chunk)) {
+      throw std::runtime_error(utility::concatenate(path, " stores a chunked list of a different type!"));
+    }
+
+    listPtr = std::launder(static_cast<list_type *>(arena.root()));
+
+    // The fences of the list were allocated outside the file, by the process which last mapped it
+    listPtr->forget_fences();
+
+    if (arena.previous_base() != arena.base()) {
+      relocate(arena.base() - arena.previous_base());
+    }
+
+    listPtr->chunk_allocator = MappedAllocator<Chunk>{arena};
+  }
+
+  template<typename T, size_t ChunkSize>
+  MappedChunkedList<T, ChunkSize>::~MappedChunkedList() {
+    listPtr->release_fences();
+  }
+
+  template<typename T, size_t ChunkSize>
+  typename MappedChunkedList<T, ChunkSize>::list_type &MappedChunkedList<T, ChunkSize>::operator*() {
+    return *listPtr;
+  }
+
+  template<typename T, size_t ChunkSize>
+  const typename MappedChunkedList<T, ChunkSize>::list_type &MappedChunkedList<T, ChunkSize>::operator*() const {
+    return *listPtr;
+  }
+
+  template<typename T, size_t ChunkSize>
+  typename MappedChunkedList<T, ChunkSize>::list_type *MappedChunkedList<T, ChunkSize>::operator->() {
+    return listPtr;
+  }
+
+  template<typename T, size_t ChunkSize>
+  const typename MappedChunkedList<T, ChunkSize>::list_type *MappedChunkedList<T, ChunkSize>::operator->() const {
+    return listPtr;
+  }
+
+  template<typename T, size_t ChunkSize>
+  typename MappedChunkedList<T, ChunkSize>::list_type &MappedChunkedList<T, ChunkSize>::list() {
+    return *listPtr;
+  }
+
+  template<typename T, size_t ChunkSize>
+  const typename MappedChunkedList<T, ChunkSize>::list_type &MappedChunkedList<T, ChunkSize>::list() const {
+    return *listPtr;
+  }
+
+  template<typename T, size_t ChunkSize>
+  void MappedChunkedList<T, ChunkSize>::sync() const {
+    arena.sync();
+  }
+
+  template<typename T, size_t ChunkSize>
+  size_t MappedChunkedList<T, ChunkSize>::mapped_size() const {
+    return arena.mapped_size();
+  }
+
+  template<typename T, size_t ChunkSize>
+  void MappedChunkedList<T, ChunkSize>::relocate(const std::ptrdiff_t offset) {
+    auto shift = [offset](Chunk *chunkPtr) {
+      return reinterpret_cast<Chunk *>(reinterpret_cast<std::byte *>(chunkPtr) + offset);
+    };
+
+    Chunk *sentinel = listPtr->get_sentinel();
+    sentinel->prevChunk = shift(sentinel->prevChunk);
+    sentinel->nextChunk = shift(sentinel->nextChunk);
+
+    for (Chunk *chunkPtr = sentinel->nextChunk; chunkPtr != sentinel; chunkPtr = chunkPtr->nextChunk) {
+      chunkPtr->prevChunk = shift(chunkPtr->prevChunk);
+      chunkPtr->nextChunk = shift(chunkPtr->nextChunk);
+    }
+  }
+} // namespace chunked_list
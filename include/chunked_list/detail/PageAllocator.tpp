@@ -0,0 +1,162 @@
+#pragma once
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <new>
+
+#include "../PageAllocator.hpp"
+
+namespace chunked_list {
+  // ---------------------------------------------------------------------------------------------------------------------
+  // PageArena implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  inline PageArena::PageArena(const size_t objectSize, const size_t objectAlignment, const bool hugePages) :
+      blockSize{utility::align_up(std::max(objectSize, sizeof(void *)), std::max(objectAlignment, alignof(void *)))},
+      wantsHugePages{hugePages}, hasHugePages{hugePages} {
+    const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    regionSize = utility::align_up(std::max(blockSize, huge_page_size), hugePages ? huge_page_size : pageSize);
+  }
+
+  inline PageArena::~PageArena() {
+    for (std::byte *region : regions) {
+      unmap(region, regionSize);
+    }
+  }
+
+  inline void *PageArena::allocate_block() {
+    std::lock_guard lock{mutex};
+
+    if (freeHead) {
+      void *block = freeHead;
+      freeHead = *static_cast<void **>(block);
+      return block;
+    }
+
+    if (static_cast<size_t>(bumpEnd - bump) < blockSize) {
+      grow();
+    }
+
+    void *block = bump;
+    bump += blockSize;
+    return block;
+  }
+
+  inline void PageArena::deallocate_block(void *block) {
+    std::lock_guard lock{mutex};
+
+    *static_cast<void **>(block) = freeHead;
+    freeHead = block;
+  }
+
+  inline size_t PageArena::block_size() const { return blockSize; }
+
+  inline size_t PageArena::mapped_size() const {
+    std::lock_guard lock{mutex};
+    return regions.size() * regionSize;
+  }
+
+  inline bool PageArena::huge_pages() const {
+    std::lock_guard lock{mutex};
+    return wantsHugePages && hasHugePages && !regions.empty();
+  }
+
+  inline void *PageArena::map(const size_t size, const bool hugePages) {
+    if (!hugePages) {
+      void *region = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+      if (region == MAP_FAILED) {
+        throw std::bad_alloc{};
+      }
+
+      return region;
+    }
+
+    // Huge pages are only used for huge page aligned ranges, so an extra huge page is mapped to align the region within
+    const size_t mappedSize = size + huge_page_size;
+    void *mapping = ::mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (mapping == MAP_FAILED) {
+      throw std::bad_alloc{};
+    }
+
+    auto *start = static_cast<std::byte *>(mapping);
+    auto *region =
+      reinterpret_cast<std::byte *>(utility::align_up(reinterpret_cast<uintptr_t>(start), huge_page_size));
+    const size_t leading = static_cast<size_t>(region - start);
+
+    if (leading != 0) {
+      ::munmap(start, leading);
+    }
+
+    ::munmap(region + size, mappedSize - leading - size);
+
+    return region;
+  }
+
+  inline void PageArena::unmap(void *region, const size_t size) { ::munmap(region, size); }
+
+  inline void PageArena::grow() {
+    void *region = map(regionSize, wantsHugePages);
+
+#ifdef MADV_HUGEPAGE
+    if (wantsHugePages && ::madvise(region, regionSize, MADV_HUGEPAGE) != 0) {
+      hasHugePages = false;
+    }
+#else
+    hasHugePages = false;
+#endif
+
+    try {
+      regions.push_back(static_cast<std::byte *>(region));
+    } catch (...) {
+      unmap(region, regionSize);
+      throw;
+    }
+
+    bump = static_cast<std::byte *>(region);
+    bumpEnd = bump + regionSize;
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------------
+  // BasicPageAllocator implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<typename T, bool HugePages>
+  template<typename U>
+  BasicPageAllocator<T, HugePages>::BasicPageAllocator(const BasicPageAllocator<U, HugePages> &) {}
+
+  template<typename T, bool HugePages>
+  T *BasicPageAllocator<T, HugePages>::allocate(const size_t n) {
+    if (n == 1) {
+      return static_cast<T *>(arena().allocate_block());
+    }
+
+    const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    return static_cast<T *>(PageArena::map(utility::align_up(n * sizeof(T), pageSize), false));
+  }
+
+  template<typename T, bool HugePages>
+  void BasicPageAllocator<T, HugePages>::deallocate(T *ptr, const size_t n) {
+    if (n == 1) {
+      arena().deallocate_block(ptr);
+      return;
+    }
+
+    const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    PageArena::unmap(ptr, utility::align_up(n * sizeof(T), pageSize));
+  }
+
+  template<typename T, bool HugePages>
+  PageArena &BasicPageAllocator<T, HugePages>::arena() {
+    static PageArena *const sharedArena = new PageArena{sizeof(T), alignof(T), HugePages};
+    return *sharedArena;
+  }
+
+  template<typename T, bool HugePages>
+  template<typename U>
+  bool BasicPageAllocator<T, HugePages>::operator==(const BasicPageAllocator<U, HugePages> &) const {
+    return true;
+  }
+} // namespace chunked_list
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <new>
+
+#include "../PoolAllocator.hpp"
+
+namespace chunked_list {
+  // ---------------------------------------------------------------------------------------------------------------------
+  // ChunkPool implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<size_t Size, size_t Alignment>
+  ChunkPool<Size, Alignment>::Flusher::~Flusher() {
+    spill(cache.count);
+    cache.flushed = true;
+  }
+
+  template<size_t Size, size_t Alignment>
+  typename ChunkPool<Size, Alignment>::Overflow &ChunkPool<Size, Alignment>::overflow() {
+    // Never destroyed, so threads exiting after the end of main can still spill into it
+    static Overflow *const pool = new Overflow{};
+    return *pool;
+  }
+
+  template<size_t Size, size_t Alignment>
+  void ChunkPool<Size, Alignment>::spill(size_t count) {
+    Overflow &pool = overflow();
+    std::lock_guard lock{pool.mutex};
+    size_t pooled = pool.count.load(std::memory_order_relaxed);
+
+    for (; count > 0 && cache.head; --count) {
+      void *block = cache.head;
+      cache.head = *static_cast<void **>(block);
+      --cache.count;
+
+      if (pooled < global_capacity) {
+        *static_cast<void **>(block) = pool.head;
+        pool.head = block;
+        ++pooled;
+      } else {
+        release(block);
+      }
+    }
+
+    pool.count.store(pooled, std::memory_order_relaxed);
+  }
+
+  template<size_t Size, size_t Alignment>
+  void ChunkPool<Size, Alignment>::refill(size_t count) {
+    Overflow &pool = overflow();
+
+    // A growing workload finds the pool empty every time, and goes on to operator new without taking the lock. A
+    // stale count only sends a thread to operator new, or to find the pool empty under the lock
+    if (pool.count.load(std::memory_order_relaxed) == 0) {
+      return;
+    }
+
+    std::lock_guard lock{pool.mutex};
+    size_t pooled = pool.count.load(std::memory_order_relaxed);
+
+    for (; count > 0 && pool.head; --count) {
+      void *block = pool.head;
+      pool.head = *static_cast<void **>(block);
+      --pooled;
+
+      *static_cast<void **>(block) = cache.head;
+      cache.head = block;
+      ++cache.count;
+    }
+
+    pool.count.store(pooled, std::memory_order_relaxed);
+  }
+
+  template<size_t Size, size_t Alignment>
+  void ChunkPool<Size, Alignment>::flush_on_exit() {
+    static thread_local Flusher flusher;
+    static_cast<void>(flusher);
+  }
+
+  template<size_t Size, size_t Alignment>
+  void ChunkPool<Size, Alignment>::release(void *block) {
+    ::operator delete(block, block_size, std::align_val_t{block_alignment});
+  }
+
+  template<size_t Size, size_t Alignment>
+  void *ChunkPool<Size, Alignment>::allocate() {
+    if (!cache.head && !cache.flushed) {
+      flush_on_exit();
+      refill(local_capacity / 2);
+    }
+
+    if (void *block = cache.head) {
+      cache.head = *static_cast<void **>(block);
+      --cache.count;
+      return block;
+    }
+
+    return ::operator new(block_size, std::align_val_t{block_alignment});
+  }
+
+  template<size_t Size, size_t Alignment>
+  void ChunkPool<Size, Alignment>::deallocate(void *block) {
+    if (!cache.head && !cache.flushed) {
+      flush_on_exit();
+    }
+
+    *static_cast<void **>(block) = cache.head;
+    cache.head = block;
+    ++cache.count;
+
+    // After the thread has been flushed, nothing would flush the free list again
+    if (cache.flushed) {
+      spill(cache.count);
+    } else if (cache.count > local_capacity) {
+      spill(local_capacity / 2);
+    }
+  }
+
+  template<size_t Size, size_t Alignment>
+  size_t ChunkPool<Size, Alignment>::cached() {
+    return cache.count;
+  }
+
+  template<size_t Size, size_t Alignment>
+  size_t ChunkPool<Size, Alignment>::overflowed() {
+    return overflow().count.load(std::memory_order_relaxed);
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------------
+  // PoolAllocator implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<typename T>
+  template<typename U>
+  PoolAllocator<T>::PoolAllocator(const PoolAllocator<U> &) {}
+
+  template<typename T>
+  T *PoolAllocator<T>::allocate(const size_t n) {
+    if (n == 1) {
+      return static_cast<T *>(pool_type::allocate());
+    }
+
+    return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+  }
+
+  template<typename T>
+  void PoolAllocator<T>::deallocate(T *ptr, const size_t n) {
+    if (n == 1) {
+      pool_type::deallocate(ptr);
+      return;
+    }
+
+    ::operator delete(ptr, n * sizeof(T), std::align_val_t{alignof(T)});
+  }
+
+  template<typename T>
+  template<typename U>
+  bool PoolAllocator<T>::operator==(const PoolAllocator<U> &) const {
+    return true;
+  }
+} // namespace chunked_list
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+#include "../SmallChunkedList.hpp"
+
+namespace chunked_list {
+  // ---------------------------------------------------------------------------------------------------------------------
+  // generic_iterator implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::generic_iterator<Mutable>::generic_iterator(
+    ListT *list, const size_t index, SpillIteratorT spilled) : list{list}, index{index}, spilled{spilled} {}
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  typename SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::template generic_iterator<Mutable>::ValueT &
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::generic_iterator<Mutable>::operator*() const {
+    return index < InlineCapacity ? list->inline_data()[index] : *spilled;
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  typename SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::template generic_iterator<Mutable>::ValueT *
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::generic_iterator<Mutable>::operator->() const {
+    return &**this;
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  typename SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::template generic_iterator<Mutable> &
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::generic_iterator<Mutable>::operator++() {
+    // The spill iterator stays on the first heap element until the last inline element has been passed
+    if (index >= InlineCapacity) {
+      ++spilled;
+    }
+
+    ++index;
+    return *this;
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  typename SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::template generic_iterator<Mutable>
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::generic_iterator<Mutable>::operator++(int) {
+    generic_iterator original = *this;
+    ++*this;
+    return original;
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  typename SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::template generic_iterator<Mutable> &
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::generic_iterator<Mutable>::operator--() {
+    --index;
+
+    if (index >= InlineCapacity) {
+      --spilled;
+    }
+
+    return *this;
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  typename SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::template generic_iterator<Mutable>
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::generic_iterator<Mutable>::operator--(int) {
+    generic_iterator original = *this;
+    --*this;
+    return original;
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  template<bool Mutable>
+  bool SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::generic_iterator<Mutable>::operator==(
+    const generic_iterator &other) const {
+    return index == other.index;
+  }
+
+  // ---------------------------------------------------------------------------------------------------------------------
+  // SmallChunkedList implementation
+  // ---------------------------------------------------------------------------------------------------------------------
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  T *SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::inline_data() {
+    return std::launder(reinterpret_cast<T *>(storage));
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  const T *SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::inline_data() const {
+    return std::launder(reinterpret_cast<const T *>(storage));
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  void SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::clear_inline() {
+    std::destroy_n(inline_data(), inline_count);
+    inline_count = 0;
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::SmallChunkedList(
+    std::initializer_list<T> initializerList) {
+    for (const T &value : initializerList) {
+      push_back(value);
+    }
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::SmallChunkedList(const SmallChunkedList &other) :
+      spill{other.spill} {
+    std::uninitialized_copy_n(other.inline_data(), other.inline_count, inline_data());
+    inline_count = other.inline_count;
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::SmallChunkedList(SmallChunkedList &&other) noexcept(
+    std::is_nothrow_move_constructible_v<T>) : spill{std::move(other.spill)} {
+    std::uninitialized_move_n(other.inline_data(), other.inline_count, inline_data());
+    inline_count = other.inline_count;
+    other.clear_inline();
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator> &
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::operator=(const SmallChunkedList &other) {
+    if (this != &other) {
+      SmallChunkedList copy{other};
+      operator=(std::move(copy));
+    }
+
+    return *this;
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator> &
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::operator=(SmallChunkedList &&other) noexcept(
+    std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+      clear();
+      std::uninitialized_move_n(other.inline_data(), other.inline_count, inline_data());
+      inline_count = other.inline_count;
+      other.clear_inline();
+      spill = std::move(other.spill);
+    }
+
+    return *this;
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::~SmallChunkedList() {
+    clear_inline();
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  T &SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::operator[](const size_t index) {
+    return index < InlineCapacity ? inline_data()[index] : spill[index - InlineCapacity];
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  const T &SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::operator[](const size_t index) const {
+    return index < InlineCapacity ? inline_data()[index] : spill[index - InlineCapacity];
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  void SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::push_back(const T &value) {
+    emplace_back(value);
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  void SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::push_back(T &&value) {
+    emplace_back(std::move(value));
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename... Args>
+    requires utility::can_construct<T, Args...>
+  void SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::emplace_back(Args &&...args) {
+    if (inline_count < InlineCapacity) {
+      std::construct_at(inline_data() + inline_count, std::forward<Args>(args)...);
+      ++inline_count;
+    } else {
+      spill.emplace_back(std::forward<Args>(args)...);
+    }
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  void SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::pop_back() {
+    if (!spill.empty()) {
+      spill.pop_back();
+    } else {
+      std::destroy_at(inline_data() + --inline_count);
+    }
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  void SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::clear() {
+    spill.clear();
+    clear_inline();
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  typename SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::iterator
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::begin() {
+    return iterator{this, 0, spill.begin()};
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  typename SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::const_iterator
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::begin() const {
+    return const_iterator{this, 0, spill.begin()};
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  typename SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::const_iterator
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::cbegin() const {
+    return begin();
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  typename SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::iterator
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::end() {
+    return iterator{this, size(), spill.end()};
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  typename SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::const_iterator
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::end() const {
+    return const_iterator{this, size(), spill.end()};
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  typename SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::const_iterator
+  SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::cend() const {
+    return end();
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  template<typename Function>
+  void SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::for_each_segment(Function function) const {
+    if (inline_count > 0) {
+      function(inline_data(), inline_count);
+    }
+
+    spill.for_each_segment(function);
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  size_t SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::size() const {
+    return inline_count + spill.size();
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  bool SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::empty() const {
+    return inline_count == 0;
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  bool SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::spilled() const {
+    return !spill.empty();
+  }
+
+  template<typename T, size_t InlineCapacity, size_t ChunkSize, template<typename> typename Allocator>
+  bool SmallChunkedList<T, InlineCapacity, ChunkSize, Allocator>::operator==(const SmallChunkedList &other) const {
+    return size() == other.size() && std::equal(begin(), end(), other.begin());
+  }
+} // namespace chunked_list
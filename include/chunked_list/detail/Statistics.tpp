@@ -0,0 +1,28 @@
+#pragma once
+
+#include "../Statistics.hpp"
+
+namespace chunked_list {
+  inline void Statistics::reset() {
+    chunk_allocations.store(0, std::memory_order_relaxed);
+    chunk_deallocations.store(0, std::memory_order_relaxed);
+    chunk_walks.store(0, std::memory_order_relaxed);
+    chunks_walked.store(0, std::memory_order_relaxed);
+    elements_moved.store(0, std::memory_order_relaxed);
+  }
+
+  namespace utility {
+    template<typename ChunkedListType>
+    void record(std::atomic<size_t> Statistics::*counter, const size_t amount) {
+      if constexpr (enable_statistics<ChunkedListType>) {
+        (statistics_of<ChunkedListType>.*counter).fetch_add(amount, std::memory_order_relaxed);
+      }
+    }
+
+    template<typename ChunkedListType>
+    void record_walk(const size_t chunks) {
+      record<ChunkedListType>(&Statistics::chunk_walks);
+      record<ChunkedListType>(&Statistics::chunks_walked, chunks);
+    }
+  } // namespace utility
+} // namespace chunked_list
@@ -26,9 +26,15 @@ namespace chunked_list {
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
-  typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>
+  typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable> &
   ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator++() {
     chunk = chunk->nextChunk;
+
+    // A chunk iterated on its own ends at a null link
+    if (chunk) {
+      prefetch_chunk(chunk->nextChunk);
+    }
+
     return *this;
   }
 
@@ -36,16 +42,22 @@ namespace chunked_list {
   template<bool Mutable>
   typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>
   ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator++(int) {
-    iterator original = *this;
-    chunk = chunk->nextChunk;
+    generic_chunk_iterator original = *this;
+    operator++();
     return original;
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
-  typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>
+  typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable> &
   ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator--() {
     chunk = chunk->prevChunk;
+
+    // A chunk iterated on its own ends at a null link
+    if (chunk) {
+      prefetch_chunk(chunk->prevChunk);
+    }
+
     return *this;
   }
 
@@ -54,7 +66,7 @@ namespace chunked_list {
   typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>
   ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator--(int) {
     generic_chunk_iterator original = *this;
-    chunk = chunk->prevChunk;
+    operator--();
     return original;
   }
 
@@ -63,6 +75,7 @@ namespace chunked_list {
   typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>
   ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator+(size_t offset) const {
     ChunkT *ptr{chunk};
+    utility::record_walk<ChunkedList>(offset);
 
     for (; offset > 0; --offset)
       ptr = ptr->nextChunk;
@@ -75,6 +88,7 @@ namespace chunked_list {
   typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>
   ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator-(size_t offset) const {
     ChunkT *ptr{chunk};
+    utility::record_walk<ChunkedList>(offset);
 
     for (; offset > 0; --offset)
       ptr = ptr->prevChunk;
@@ -84,14 +98,14 @@ namespace chunked_list {
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
-  typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>
+  typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable> &
   ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator+=(const size_t offset) {
     return *this = operator+(offset);
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
-  typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>
+  typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable> &
   ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator-=(const size_t offset) {
     return *this = operator-(offset);
   }
@@ -117,13 +131,6 @@ namespace chunked_list {
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
   typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>::ChunkT &
-  ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator*() {
-    return *chunk;
-  }
-
-  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
-  template<bool Mutable>
-  const typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>::ChunkT &
   ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator*() const {
     return *chunk;
   }
@@ -131,13 +138,6 @@ namespace chunked_list {
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
   typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>::ChunkT *
-  ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator->() {
-    return chunk;
-  }
-
-  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
-  template<bool Mutable>
-  const typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>::ChunkT *
   ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator->() const {
     return chunk;
   }
@@ -145,13 +145,6 @@ namespace chunked_list {
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
   typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>::ChunkT &
-  ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator[](const size_t n) {
-    return *operator+(n);
-  }
-
-  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
-  template<bool Mutable>
-  const typename ChunkedList<T, ChunkSize, Allocator>::template generic_chunk_iterator<Mutable>::ChunkT &
   ChunkedList<T, ChunkSize, Allocator>::generic_chunk_iterator<Mutable>::operator[](const size_t n) const {
     return *operator+(n);
   }
@@ -198,11 +191,9 @@ namespace chunked_list {
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
-  typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>
+  typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable> &
   ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator++() {
-    if (index < ChunkSize - 1) {
-      ++index;
-    } else {
+    if (++index >= chunkIterator->size()) {
       ++chunkIterator;
       index = 0;
     }
@@ -221,11 +212,11 @@ namespace chunked_list {
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
-  typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>
+  typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable> &
   ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator--() {
     if (index == 0) {
-      index = ChunkSize - 1;
       --chunkIterator;
+      index = chunkIterator->size() - 1;
     } else {
       --index;
     }
@@ -237,7 +228,7 @@ namespace chunked_list {
   template<bool Mutable>
   typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>
   ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator--(int) {
-    iterator original = *this;
+    generic_iterator original = *this;
     operator--();
     return original;
   }
@@ -245,48 +236,53 @@ namespace chunked_list {
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
   typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>
-  ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator+(size_t n) {
-    size_t chunkOffset = n / ChunkSize;
-    n %= ChunkSize;
-
-    const size_t iteratorIndex = index + n;
-
-    if (iteratorIndex >= ChunkSize) {
-      return generic_iterator{chunkIterator + (chunkOffset + 1), iteratorIndex - ChunkSize};
+  ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator+(size_t n) const {
+    chunk_iterator_type chunkIt = chunkIterator;
+    size_t walked = 0;
+    n += index;
+
+    for (; n > 0 && n >= chunkIt->size(); ++walked) {
+      n -= chunkIt->size();
+      ++chunkIt;
     }
 
-    return generic_iterator{chunkIterator + chunkOffset, iteratorIndex};
+    utility::record_walk<ChunkedList>(walked);
+    return generic_iterator{chunkIt, n};
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
   typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>
-  ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator-(size_t n) {
-    auto chunkIt = chunkIterator;
-
-    while (n > ChunkSize) {
-      --chunkIt;
-      n -= ChunkSize;
+  ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator-(size_t n) const {
+    if (n <= index) {
+      return generic_iterator{chunkIterator, index - n};
     }
 
-    if (n > index) {
+    chunk_iterator_type chunkIt = chunkIterator;
+    n -= index;
+
+    for (size_t walked = 1;; ++walked) {
       --chunkIt;
-      return generic_iterator{chunkIt, ChunkSize - n + index};
-    }
 
-    return generic_iterator{chunkIt, index - n};
+      if (n <= chunkIt->size()) {
+        utility::record_walk<ChunkedList>(walked);
+        return generic_iterator{chunkIt, chunkIt->size() - n};
+      }
+
+      n -= chunkIt->size();
+    }
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
-  typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>
+  typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable> &
   ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator+=(const size_t n) {
     return *this = operator+(n);
   }
 
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
-  typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>
+  typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable> &
   ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator-=(const size_t n) {
     return *this = operator-(n);
   }
@@ -310,13 +306,6 @@ namespace chunked_list {
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
   typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>::ValueT &
-  ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator*() {
-    return (*chunkIterator)[index];
-  }
-
-  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
-  template<bool Mutable>
-  const typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>::ValueT &
   ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator*() const {
     return (*chunkIterator)[index];
   }
@@ -324,13 +313,6 @@ namespace chunked_list {
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
   typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>::ValueT *
-  ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator->() {
-    return &(*chunkIterator)[index];
-  }
-
-  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
-  template<bool Mutable>
-  const typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>::ValueT *
   ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator->() const {
     return &(*chunkIterator)[index];
   }
@@ -338,13 +320,6 @@ namespace chunked_list {
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
   template<bool Mutable>
   typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>::ValueT &
-  ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator[](const size_t n) {
-    return *operator+(n);
-  }
-
-  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
-  template<bool Mutable>
-  const typename ChunkedList<T, ChunkSize, Allocator>::template generic_iterator<Mutable>::ValueT &
   ChunkedList<T, ChunkSize, Allocator>::generic_iterator<Mutable>::operator[](const size_t n) const {
     return *operator+(n);
   }
@@ -1,7 +1,37 @@
 #pragma once
 
+#include <charconv>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
 #include <type_traits>
+#include <version>
+
+#if __has_include(<unistd.h>)
+#include <climits>
+#include <sys/uio.h>
+#include <unistd.h>
+#define CHUNKED_LIST_POSIX 1
+#else
+#define CHUNKED_LIST_POSIX 0
+#endif
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#if defined(__cpp_lib_format)
+#define CHUNKED_LIST_FORMAT 1
+#else
+#define CHUNKED_LIST_FORMAT 0
+#endif
+
+#ifndef CHUNKED_LIST_PREFETCH_DISTANCE
+#define CHUNKED_LIST_PREFETCH_DISTANCE 4
+#endif
+
+#include "../Statistics.hpp"
 
 namespace chunked_list {
   template<typename T, size_t ChunkSize, template<typename> typename Allocator>
@@ -16,6 +46,18 @@ namespace chunked_list {
       HeapSort,
     };
 
+    /**
+     * @brief The header written before the element bytes of a chunked list by write_binary
+     */
+    struct BinaryHeader {
+        static constexpr std::uint32_t current_version = 1;
+
+        char magic[4]{'C', 'K', 'L', 'B'};
+        std::uint32_t version{current_version};
+        std::uint64_t value_size{0};
+        std::uint64_t element_count{0};
+    };
+
     template<typename OutputStream>
     using DeduceStreamStringType = decltype(std::declval<OutputStream>().str());
 
@@ -51,7 +93,8 @@ namespace chunked_list {
     concept are_iterators = (iterator<ChunkedListType, Types> && ...);
 
     template<typename ChunkedListType, typename T>
-    concept chunk_iterator = is_template_of<ChunkedListType::template generic_chunk_iterator, T>;
+    concept chunk_iterator = std::is_same_v<T, typename ChunkedListType::chunk_iterator> ||
+                             std::is_same_v<T, typename ChunkedListType::const_chunk_iterator>;
 
     template<typename ChunkedListType, typename... Types>
     concept are_chunk_iterators = (chunk_iterator<ChunkedListType, Types> && ...);
@@ -107,6 +150,140 @@ namespace chunked_list {
     template<string_compatible... Args>
     std::string concatenate(Args &&...args);
 
+    template<typename T>
+    concept character = std::is_same_v<T, bool> || std::is_same_v<T, char> || std::is_same_v<T, signed char> ||
+                        std::is_same_v<T, unsigned char> || std::is_same_v<T, wchar_t> ||
+                        std::is_same_v<T, char8_t> || std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>;
+
+    /**
+     * @brief Arithmetic types which are inserted into an ostream as numbers, and can therefore be written with
+     * std::to_chars instead
+     */
+    template<typename T>
+    concept to_chars_compatible = (std::is_integral_v<T> && !character<T>) || std::is_floating_point_v<T>;
+
+    /**
+     * @brief Integral types other than bool, which are the ones std::make_unsigned accepts
+     */
+    template<typename T>
+    concept integer = std::integral<T> && !std::same_as<T, bool>;
+
+    /**
+     * @brief Scalar types whose values are equal exactly when their bytes are, so ranges of them can be compared with
+     * memcmp and hashed a block of bytes at a time. Floating point types are excluded, as 0.0 equals -0.0 and NaN
+     * equals nothing
+     */
+    template<typename T>
+    concept bytewise_comparable = std::is_scalar_v<T> && std::has_unique_object_representations_v<T>;
+
+    template<typename T>
+    concept hashable = requires(const T &value) {
+      { std::hash<T>{}(value) } -> std::convertible_to<size_t>;
+    };
+
+    /**
+     * @brief Hashes a sequence of bytes fed in any number of pieces eight bytes at a time, buffering a partial word
+     * between pieces, so the hash of a sequence does not depend on how it was split
+     */
+    class StreamHasher {
+        std::uint64_t state{0x9e3779b97f4a7c15};
+        std::uint64_t length{0};
+        unsigned char pending[8]{};
+        size_t pending_size{0};
+
+        void mix(std::uint64_t word);
+
+      public:
+        void update(const void *bytes, size_t size);
+
+        /**
+         * @return The hash of every byte fed so far, leaving the hasher able to be fed more
+         */
+        std::uint64_t digest() const;
+    };
+
+    /**
+     * @brief The precision of a default constructed ostream
+     */
+    inline constexpr int default_precision = 6;
+
+    /**
+     * @brief The largest precision for which every number written by write_chars fits in to_chars_buffer_size
+     */
+    inline constexpr int max_fast_precision = 64;
+
+    inline constexpr size_t to_chars_buffer_size = 128;
+
+    /**
+     * @brief Writes a number the way a default formatted ostream with the given precision would insert it
+     * @return The end of the characters written, or nullptr if the buffer was too small
+     */
+    template<to_chars_compatible T>
+    char *write_chars(char *first, char *last, T value, int precision = default_precision);
+
+    /**
+     * @return The number of characters write_chars writes for a number
+     */
+    template<to_chars_compatible T>
+    size_t chars_length(T value, int precision = default_precision);
+
+    /**
+     * @return The smallest multiple of the alignment which is greater than or equal to the value
+     */
+    constexpr size_t align_up(size_t value, size_t alignment);
+
+    /**
+     * @brief The size in bytes of the elements from which bulk operations on a list split its chunks between threads,
+     * large enough that starting the threads costs little next to the work they share
+     */
+    inline constexpr size_t parallel_threshold = size_t{16} << 20;
+
+    /**
+     * @brief Splits [0, count) into contiguous ranges, calling the function with the bounds of each on up to
+     * hardware_concurrency threads including the calling one. Once every thread has finished, the first exception
+     * thrown by any of them is rethrown
+     * @tparam Function A callable taking the start (inclusive) and end (exclusive) of a range
+     */
+    template<typename Function>
+    void parallel_for(size_t count, Function function);
+
+    /**
+     * @brief The number of chunks ahead of a traversal over every chunk, such as for_each_segment, fill or a copy,
+     * which are prefetched, set by defining CHUNKED_LIST_PREFETCH_DISTANCE. Iterators hold no lookahead, so they only
+     * prefetch the next chunk on each step whatever the distance, and 0 disables prefetching altogether
+     */
+    inline constexpr size_t prefetch_distance = CHUNKED_LIST_PREFETCH_DISTANCE;
+
+    /**
+     * @brief Hints that the cache line holding the address will be read soon, doing nothing on compilers without a
+     * prefetch builtin
+     */
+    inline void prefetch(const void *address);
+
+#if CHUNKED_LIST_POSIX
+    /**
+     * @brief Writes every byte of a buffer to a file descriptor, retrying on partial writes and interrupts
+     */
+    inline void write_fd(int fd, const void *buffer, size_t size);
+
+    /**
+     * @brief Reads exactly size bytes from a file descriptor, retrying on partial reads and interrupts
+     */
+    inline void read_fd(int fd, void *buffer, size_t size);
+
+#ifdef IOV_MAX
+    inline constexpr size_t iov_max = IOV_MAX;
+#else
+    inline constexpr size_t iov_max = 1024;
+#endif
+
+    /**
+     * @brief Writes every byte referenced by a sequence of iovecs to a file descriptor, in batches of at most iov_max
+     * iovecs, retrying on partial writes and interrupts. The iovecs are consumed in the process
+     */
+    inline void writev_fd(int fd, iovec *iovecs, size_t count);
+#endif
+
     template<typename T, typename ChunkedListType>
     using rebind_value = ChunkedList<T, ChunkedListType::chunk_size, ChunkedListType::template allocator_type>;
 
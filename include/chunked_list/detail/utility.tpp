@@ -1,7 +1,14 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstring>
 #include <queue>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 #include "utility.hpp"
 
@@ -34,6 +41,252 @@ namespace chunked_list::utility {
     return (intoString(std::move(args)) += ...);
   }
 
+  template<to_chars_compatible T>
+  char *write_chars(char *first, char *last, const T value, const int precision) {
+    std::to_chars_result result;
+
+    if constexpr (std::is_floating_point_v<T>) {
+      result = std::to_chars(first, last, value, std::chars_format::general, precision);
+    } else {
+      result = std::to_chars(first, last, value);
+    }
+
+    return result.ec == std::errc{} ? result.ptr : nullptr;
+  }
+
+  template<to_chars_compatible T>
+  size_t chars_length(const T value, const int precision) {
+    if constexpr (std::is_floating_point_v<T>) {
+      char buffer[to_chars_buffer_size];
+      return write_chars(buffer, buffer + to_chars_buffer_size, value, precision) - buffer;
+    } else {
+      using Unsigned = std::make_unsigned_t<T>;
+
+      size_t length = 1;
+      Unsigned magnitude = static_cast<Unsigned>(value);
+
+      if constexpr (std::is_signed_v<T>) {
+        if (value < 0) {
+          magnitude = static_cast<Unsigned>(Unsigned{0} - magnitude);
+          ++length;
+        }
+      }
+
+      for (; magnitude >= 10; magnitude /= 10) {
+        ++length;
+      }
+
+      return length;
+    }
+  }
+
+  constexpr size_t align_up(const size_t value, const size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+  }
+
+  template<typename Function>
+  void parallel_for(const size_t count, Function function) {
+    const size_t threads = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, std::max<size_t>(count, 1));
+
+    if (threads == 1) {
+      function(size_t{0}, count);
+      return;
+    }
+
+    std::vector<std::exception_ptr> exceptions(threads);
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+
+    auto run = [&function, &exceptions, count, threads](const size_t worker) {
+      try {
+        function(count * worker / threads, count * (worker + 1) / threads);
+      } catch (...) {
+        exceptions[worker] = std::current_exception();
+      }
+    };
+
+    try {
+      for (size_t worker = 1; worker < threads; ++worker) {
+        workers.emplace_back(run, worker);
+      }
+    } catch (...) {
+      // Without every thread, the ranges of the missing ones are run on the calling thread
+      for (size_t worker = workers.size() + 1; worker < threads; ++worker) {
+        run(worker);
+      }
+    }
+
+    run(0);
+
+    for (std::thread &worker : workers) {
+      worker.join();
+    }
+
+    for (const std::exception_ptr &exception : exceptions) {
+      if (exception) {
+        std::rethrow_exception(exception);
+      }
+    }
+  }
+
+  inline void StreamHasher::mix(const std::uint64_t word) {
+    state = std::rotl(state ^ word * 0x9fb21c651e98df25, 27) * 0xc2b2ae3d27d4eb4f + 0x165667b19e3779f9;
+  }
+
+  inline void StreamHasher::update(const void *bytes, size_t size) {
+    auto data = static_cast<const unsigned char *>(bytes);
+    length += size;
+
+    if (pending_size > 0) {
+      const size_t taken = std::min(size, sizeof(pending) - pending_size);
+      std::memcpy(pending + pending_size, data, taken);
+      pending_size += taken;
+      data += taken;
+      size -= taken;
+
+      if (pending_size < sizeof(pending)) {
+        return;
+      }
+
+      std::uint64_t word;
+      std::memcpy(&word, pending, sizeof(word));
+      mix(word);
+      pending_size = 0;
+    }
+
+    for (; size >= sizeof(std::uint64_t); data += sizeof(std::uint64_t), size -= sizeof(std::uint64_t)) {
+      std::uint64_t word;
+      std::memcpy(&word, data, sizeof(word));
+      mix(word);
+    }
+
+    std::memcpy(pending, data, size);
+    pending_size = size;
+  }
+
+  inline std::uint64_t StreamHasher::digest() const {
+    StreamHasher finished = *this;
+
+    if (pending_size > 0) {
+      std::uint64_t word = 0;
+      std::memcpy(&word, pending, pending_size);
+      finished.mix(word);
+    }
+
+    // The length tells apart sequences which differ only by trailing zero bytes, then the splitmix64 finalizer spreads
+    // every bit of the state over the result
+    std::uint64_t hash = finished.state ^ length;
+    hash = (hash ^ hash >> 30) * 0xbf58476d1ce4e5b9;
+    hash = (hash ^ hash >> 27) * 0x94d049bb133111eb;
+    return hash ^ hash >> 31;
+  }
+
+  inline void prefetch([[maybe_unused]] const void *address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#endif
+  }
+
+#if CHUNKED_LIST_POSIX
+  inline void write_fd(const int fd, const void *buffer, size_t size) {
+    auto bytes = static_cast<const std::byte *>(buffer);
+
+    while (size > 0) {
+      const ssize_t written = ::write(fd, bytes, size);
+
+      if (written < 0) {
+        if (errno == EINTR)
+          continue;
+
+        throw std::runtime_error(concatenate("Failed to write to file descriptor ", fd, "!"));
+      }
+
+      bytes += written;
+      size -= static_cast<size_t>(written);
+    }
+  }
+
+  inline void read_fd(const int fd, void *buffer, size_t size) {
+    auto bytes = static_cast<std::byte *>(buffer);
+
+    while (size > 0) {
+      const ssize_t received = ::read(fd, bytes, size);
+
+      if (received < 0) {
+        if (errno == EINTR)
+          continue;
+
+        throw std::runtime_error(concatenate("Failed to read from file descriptor ", fd, "!"));
+      }
+
+      if (received == 0) {
+        throw std::runtime_error("Unexpected end of file while reading from file descriptor!");
+      }
+
+      bytes += received;
+      size -= static_cast<size_t>(received);
+    }
+  }
+
+  inline void writev_fd(const int fd, iovec *iovecs, size_t count) {
+    while (count > 0) {
+      const ssize_t written = ::writev(fd, iovecs, static_cast<int>(std::min(count, iov_max)));
+
+      if (written < 0) {
+        if (errno == EINTR)
+          continue;
+
+        throw std::runtime_error(concatenate("Failed to write to file descriptor ", fd, "!"));
+      }
+
+      for (auto remaining = static_cast<size_t>(written); count > 0;) {
+        if (remaining < iovecs->iov_len) {
+          iovecs->iov_base = static_cast<std::byte *>(iovecs->iov_base) + remaining;
+          iovecs->iov_len -= remaining;
+          break;
+        }
+
+        remaining -= iovecs->iov_len;
+        ++iovecs;
+        --count;
+      }
+    }
+  }
+#endif
+
+  template<typename T, size_t ChunkSize, template<typename> typename Allocator>
+  constexpr size_t chunk_bytes() {
+    return sizeof(typename ChunkedList<T, ChunkSize, Allocator>::Chunk);
+  }
+
+  /**
+   * @brief Steps from an estimate to the greatest chunk size fitting within the bytes; padding after the elements
+   * makes the estimate off by a few elements at most
+   */
+  template<typename T, size_t Bytes, template<typename> typename Allocator, size_t Estimate>
+  constexpr size_t fit_chunk_size() {
+    if constexpr (Estimate == 0) {
+      return 0;
+    } else if constexpr (chunk_bytes<T, Estimate, Allocator>() > Bytes) {
+      return fit_chunk_size<T, Bytes, Allocator, Estimate - 1>();
+    } else if constexpr (chunk_bytes<T, Estimate + 1, Allocator>() <= Bytes) {
+      return fit_chunk_size<T, Bytes, Allocator, Estimate + 1>();
+    } else {
+      return Estimate;
+    }
+  }
+
+  template<typename T, size_t Bytes, template<typename> typename Allocator>
+  constexpr size_t chunk_size_for_bytes() {
+    constexpr size_t singleBytes = chunk_bytes<T, 1, Allocator>();
+
+    if constexpr (Bytes < singleBytes) {
+      return 0;
+    } else {
+      return fit_chunk_size<T, Bytes, Allocator, (Bytes - singleBytes) / sizeof(T) + 1>();
+    }
+  }
+
   namespace sort_functions {
     template<typename Compare, typename T, size_t ChunkSize, template<typename> typename Allocator>
     void bubble_sort(ChunkedList<T, ChunkSize, Allocator> &chunkedList) {
@@ -51,6 +304,7 @@ namespace chunked_list::utility {
           if (compare(*std::next(it), *it)) {
             sorted = false;
             std::swap(*it, *std::next(it));
+            record<ChunkedList<T, ChunkSize, Allocator>>(&Statistics::elements_moved, 2);
           }
         }
       } while (!sorted);
@@ -77,6 +331,7 @@ namespace chunked_list::utility {
 
         if (min != startingIt) {
           std::swap(*min, *startingIt);
+          record<ChunkedList<T, ChunkSize, Allocator>>(&Statistics::elements_moved, 2);
         }
 
         ++startingIt;
@@ -104,10 +359,14 @@ namespace chunked_list::utility {
             break; // value < *prevIt
 
           *it = std::move(*prevIt);
+          record<ChunkedList<T, ChunkSize, Allocator>>(&Statistics::elements_moved);
           it = prevIt;
         }
 
-        *it = std::move(value);
+        if (it != startingIt) {
+          *it = std::move(value);
+          record<ChunkedList<T, ChunkSize, Allocator>>(&Statistics::elements_moved);
+        }
       }
     }
 
@@ -140,11 +399,15 @@ namespace chunked_list::utility {
           break;
 
         std::swap(*left, *right);
+        record<ChunkedList<T, ChunkSize, Allocator>>(&Statistics::elements_moved, 2);
         ++left;
         --right;
       }
 
-      std::swap(*left, *pivot);
+      if (left != pivot) {
+        std::swap(*left, *pivot);
+        record<ChunkedList<T, ChunkSize, Allocator>>(&Statistics::elements_moved, 2);
+      }
 
       quick_sort<Compare, T, ChunkSize, Allocator>(start, left); // Left partition
       quick_sort<Compare, T, ChunkSize, Allocator>(std::next(left), end); // Right partition
@@ -158,12 +421,13 @@ namespace chunked_list::utility {
       std::priority_queue<T, std::vector<T>, Compare> heap{};
 
       for (auto it = chunkedList.begin(); it != chunkedList.end(); ++it) {
-        heap.push_back(std::move(*it));
+        heap.push(std::move(*it));
       }
 
       for (auto iterator = chunkedList.end() - 1;; --iterator) {
         *iterator = std::move(heap.top());
         heap.pop();
+        record<ChunkedList<T, ChunkSize, Allocator>>(&Statistics::elements_moved);
 
         if (iterator == chunkedList.begin())
           break;
@@ -220,4 +220,24 @@ SUBTEST(Iteration) {
   chunk.destroy(0);
 }
 
+SUBTEST(Chunk_Iteration) {
+  using ChunkIterator = typename List::chunk_iterator;
+
+  AlignedArray<Chunk, 2> chunks;
+  chunks.construct(0, static_cast<Chunk *>(nullptr), chunks + 1);
+  chunks.construct(1, chunks + 0);
+
+  // The outer links of the chain are null, so stepping past either end reaches a null chunk
+  ChunkIterator it{*chunks};
+  ASSERT(&*++it == chunks + 1)
+  ASSERT(&*--it == chunks + 0)
+  ASSERT(static_cast<Chunk *>(--it) == nullptr)
+
+  it = ChunkIterator{chunks + 1};
+  ASSERT(static_cast<Chunk *>(++it) == nullptr)
+
+  chunks.destroy(1);
+  chunks.destroy(0);
+}
+
 UNIT_TEST(Chunk)
@@ -1,9 +1,44 @@
 #include "../../include/ChunkedListDef.hpp"
 #include "../../include/Tests.hpp"
+#include "chunked_list/ChunkedSoA.hpp"
+#include "chunked_list/CompressedChunkedList.hpp"
+#include "chunked_list/CowChunkedList.hpp"
+#include "chunked_list/GeometricChunkedList.hpp"
+#include "chunked_list/HiveChunkedList.hpp"
+#include "chunked_list/PageAllocator.hpp"
+#include "chunked_list/PoolAllocator.hpp"
+#include "chunked_list/SmallChunkedList.hpp"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <thread>
 
 #undef TEST_DEFS
 #define TEST_DEFS CHUNKED_LIST_DEFS CHUNKED_LIST_ITERATOR_DEFS CHUNKED_LIST_SLICE_DEFS
 
+// Wide enough that the lists of it crossing utility::parallel_threshold stay short
+using Block = std::array<long, 32>;
+
+namespace chunked_list {
+  template<size_t ChunkSize, template<typename> typename Allocator>
+  inline constexpr bool enable_statistics<ChunkedList<long, ChunkSize, Allocator>> = true;
+
+  template<size_t ChunkSize, template<typename> typename Allocator>
+  inline constexpr bool enable_zone_maps<ChunkedList<double, ChunkSize, Allocator>> = true;
+
+  template<size_t ChunkSize, template<typename> typename Allocator>
+  inline constexpr bool enable_fences<ChunkedList<long, ChunkSize, Allocator>> = true;
+
+  template<size_t ChunkSize, template<typename> typename Allocator>
+  inline constexpr bool enable_parallelism<ChunkedList<Block, ChunkSize, Allocator>> = true;
+
+  template<size_t ChunkSize, template<typename> typename Allocator>
+  inline constexpr bool enable_parallelism<ChunkedList<std::string, ChunkSize, Allocator>> = true;
+}
+
 SUBTEST(Initialization) {
   List{};
   List{BASIC_INITIALIZER_LIST};
@@ -97,4 +132,1213 @@ SUBTEST(Slicing) {
   ASSERT(slice.end() - list.size() == slice.begin())
 }
 
+SUBTEST(Splicing) {
+  List list{BASIC_INITIALIZER_LIST};
+  List other{BASIC_INITIALIZER_LIST};
+
+  list.pop_back();
+  list.splice(other);
+
+  ASSERT(other.empty())
+  ASSERT(list.size() == 31)
+
+  for (size_t i = 0; i < 15; ++i) {
+    ASSERT(list[i] == i)
+    ASSERT(list[i + 15] == i)
+  }
+
+  list.push_back(Integral{16});
+  ASSERT(list[31] == 16)
+
+  other.push_back(Integral{0});
+  ASSERT(other.size() == 1)
+}
+
+SUBTEST(Splitting) {
+  for (size_t position = 0; position <= 16; ++position) {
+    List list{BASIC_INITIALIZER_LIST};
+    List tail = list.split_at(list.begin() + position);
+
+    ASSERT(list.size() == position)
+    ASSERT(tail.size() == 16 - position)
+
+    size_t counter = 0;
+
+    ASSERT_INCREMENT(list.begin(), list.end())
+    ASSERT(counter == position)
+
+    ASSERT_INCREMENT(tail.begin(), tail.end())
+    ASSERT(counter == 16)
+
+    list.splice(tail);
+    counter = 0;
+
+    ASSERT_INCREMENT(list.begin(), list.end())
+    ASSERT(counter == 16)
+  }
+}
+
+SUBTEST(Extracting_Chunks) {
+  List list{BASIC_INITIALIZER_LIST};
+
+  auto first = list.template begin<_chunk_iterator>();
+  List extracted = list.extract_chunks(first, std::next(first));
+
+  ASSERT(extracted.size() == ChunkSize)
+  ASSERT(list.size() == 16 - ChunkSize)
+
+  size_t counter = 0;
+
+  ASSERT_INCREMENT(extracted.begin(), extracted.end())
+  ASSERT_INCREMENT(list.begin(), list.end())
+  ASSERT(counter == 16)
+}
+
+SUBTEST(Binary_Serialization) {
+  using IntList = CurrentList<int, ChunkSize, Allocator>;
+  using WideIntList = CurrentList<int, ChunkSize * 2 + 1, Allocator>;
+
+  IntList list;
+
+  for (int i = 0; i < 100; ++i) {
+    list.push_back(i);
+  }
+
+  std::stringstream stream;
+  list.write_binary(stream);
+
+  WideIntList loaded{7, 8, 9};
+  loaded.read_binary(stream);
+
+  ASSERT(loaded.size() == list.size())
+
+  for (int i = 0; i < 100; ++i) {
+    ASSERT(loaded[i] == i)
+  }
+
+  std::stringstream truncated{stream.str().substr(0, 40)};
+
+  bool threw = false;
+
+  try {
+    loaded.read_binary(truncated);
+  } catch (const std::runtime_error &) {
+    threw = true;
+  }
+
+  ASSERT(threw)
+  ASSERT(loaded.size() == list.size())
+
+  int pipeFds[2];
+  ASSERT(pipe(pipeFds) == 0)
+
+  list.write_binary(pipeFds[1]);
+  close(pipeFds[1]);
+
+  IntList piped;
+  piped.read_binary(pipeFds[0]);
+  close(pipeFds[0]);
+
+  ASSERT(piped.size() == list.size())
+
+  for (int i = 0; i < 100; ++i) {
+    ASSERT(piped[i] == i)
+  }
+}
+
+SUBTEST(Scatter_Gather) {
+  using IntList = CurrentList<int, ChunkSize, Allocator>;
+
+  IntList list;
+
+  for (int i = 0; i < 100; ++i) {
+    list.push_back(i);
+  }
+
+  size_t segments = 0;
+  size_t elements = 0;
+
+  list.for_each_segment([&](const int *data, const size_t size) {
+    ASSERT(data[0] == static_cast<int>(elements))
+    ++segments;
+    elements += size;
+  });
+
+  using IntChunkIterator = typename IntList::chunk_iterator;
+
+  ASSERT(elements == list.size())
+  ASSERT(segments == static_cast<size_t>(std::distance(list.template begin<IntChunkIterator>(),
+                                                         list.template end<IntChunkIterator>())))
+  ASSERT(list.as_iovecs().size() == segments)
+
+  int pipeFds[2];
+  ASSERT(pipe(pipeFds) == 0)
+
+  list.write_segments(pipeFds[1]);
+  close(pipeFds[1]);
+
+  IntList filled{-1};
+
+  ASSERT(filled.read_segments(pipeFds[0], 37) == 37)
+
+  while (filled.read_segments(pipeFds[0], 100) != 0) {}
+
+  close(pipeFds[0]);
+
+  ASSERT(filled.size() == list.size() + 1)
+  ASSERT(filled[0] == -1)
+
+  for (int i = 0; i < 100; ++i) {
+    ASSERT(filled[i + 1] == i)
+  }
+
+  size_t filledElements = 0;
+  filled.for_each_segment([&](const int *, const size_t size) {
+    ASSERT(size != 0)
+    filledElements += size;
+  });
+
+  ASSERT(filledElements == filled.size())
+
+  ASSERT(pipe(pipeFds) == 0)
+
+  constexpr int values[2]{1, 2};
+  ASSERT(write(pipeFds[1], values, sizeof(int) + 2) == static_cast<ssize_t>(sizeof(int) + 2))
+  close(pipeFds[1]);
+
+  IntList truncated;
+  bool threw = false;
+
+  try {
+    truncated.read_segments(pipeFds[0], 2);
+  } catch (const std::runtime_error &) {
+    threw = true;
+  }
+
+  close(pipeFds[0]);
+
+  ASSERT(threw)
+  ASSERT(truncated.size() == 0)
+  ASSERT(truncated.template begin<IntChunkIterator>() == truncated.template end<IntChunkIterator>())
+}
+
+SUBTEST(Stringification) {
+  using IntList = CurrentList<int, ChunkSize, Allocator>;
+  using DoubleList = CurrentList<double, ChunkSize, Allocator>;
+  using StringList = CurrentList<std::string, ChunkSize, Allocator>;
+
+  IntList ints{0, -1, 22, -333, 4444, std::numeric_limits<int>::min(), std::numeric_limits<int>::max()};
+  DoubleList doubles{0.5, -1.0 / 3, 1e300, 123456789.0};
+
+  std::ostringstream expectedInts;
+  std::ostringstream expectedDoubles;
+
+  for (int value : ints) {
+    expectedInts << (expectedInts.tellp() == 0 ? "" : " | ") << value;
+  }
+
+  for (double value : doubles) {
+    expectedDoubles << (expectedDoubles.tellp() == 0 ? "" : ", ") << value;
+  }
+
+  ASSERT(ints.concat(" | ") == expectedInts.str())
+  ASSERT(doubles.concat() == expectedDoubles.str())
+  ASSERT(IntList{}.concat().empty())
+
+  std::string expectedJoined = expectedInts.str();
+
+  for (size_t position; (position = expectedJoined.find(" | ")) != std::string::npos;) {
+    expectedJoined.replace(position, 3, ", ");
+  }
+
+  std::ostringstream stream;
+  stream << ints << IntList{} << StringList{"a", "b"} << IntList{7};
+  ASSERT(stream.str() == '[' + expectedJoined + "][][a, b][7]")
+
+  std::ostringstream hex;
+  hex << std::hex << IntList{255, 16};
+  ASSERT(hex.str() == "[ff, 10]")
+
+  IntList many;
+
+  for (int i = 0; i < 5000; ++i) {
+    many.push_back(i * 7919 - 1000000);
+  }
+
+  std::ostringstream expectedMany;
+  std::ostringstream insertedMany;
+
+  expectedMany << '[';
+
+  for (int value : many) {
+    expectedMany << (expectedMany.tellp() == 1 ? "" : ", ") << value;
+  }
+
+  expectedMany << ']';
+  insertedMany << many;
+
+  ASSERT(insertedMany.str() == expectedMany.str())
+  ASSERT('[' + many.concat() + ']' == expectedMany.str())
+}
+
+SUBTEST(Statistics) {
+  using StatsList = CurrentList<long, ChunkSize, Allocator>;
+
+  static_assert(!chunked_list::enable_statistics<List>);
+
+  StatsList::reset_statistics();
+  const chunked_list::Statistics &statistics = StatsList::statistics();
+
+  {
+    StatsList list;
+
+    for (long i = 0; i < 64; ++i) {
+      list.push_back(63 - i);
+    }
+
+    constexpr size_t chunks = (64 + ChunkSize - 1) / ChunkSize;
+
+    ASSERT(statistics.chunk_allocations == chunks)
+    ASSERT(list.fill_ratio() == static_cast<double>(64) / static_cast<double>(chunks * ChunkSize))
+
+    const chunked_list::MemoryUsage usage = list.memory_usage();
+
+    ASSERT(usage.chunks == chunks)
+    ASSERT(usage.used_bytes == 64 * sizeof(long))
+    ASSERT(usage.reserved_bytes >= chunks * ChunkSize * sizeof(long))
+
+    ASSERT(list[63] == 0)
+    ASSERT(statistics.chunk_walks == 1)
+    ASSERT(statistics.chunks_walked == 63 / ChunkSize)
+
+    list.erase(list.begin());
+
+    ASSERT(statistics.elements_moved == ChunkSize - 1)
+    ASSERT(statistics.chunk_deallocations == (ChunkSize == 1 ? 1 : 0))
+
+    auto assertSortMoves = [&list, &statistics](auto sort) {
+      long value = 0;
+
+      for (long &element : list) {
+        element = (value += 37) % 61;
+      }
+
+      const size_t moved = statistics.elements_moved;
+      sort();
+
+      ASSERT(std::is_sorted(list.begin(), list.end()))
+      ASSERT(statistics.elements_moved > moved)
+    };
+
+    using chunked_list::utility::SortType;
+
+    assertSortMoves([&list] { list.template sort<std::less<long>, SortType::BubbleSort>(); });
+    assertSortMoves([&list] { list.template sort<std::less<long>, SortType::SelectionSort>(); });
+    assertSortMoves([&list] { list.template sort<std::less<long>, SortType::InsertionSort>(); });
+    assertSortMoves([&list] { list.template sort<std::less<long>, SortType::QuickSort>(); });
+    assertSortMoves([&list] { list.template sort<std::less<long>, SortType::HeapSort>(); });
+  }
+
+  ASSERT(statistics.chunk_deallocations == statistics.chunk_allocations)
+  const StatsList empty;
+  ASSERT(empty.fill_ratio() == 0.0)
+  ASSERT(empty.memory_usage().reserved_bytes == 0)
+}
+
+SUBTEST(Byte_Budget) {
+  using chunked_list::utility::chunk_bytes;
+
+  constexpr size_t budget = 64 * ChunkSize;
+  using BudgetList = chunked_list::ChunkedListBytes<long, budget, Allocator>;
+  using CharList = chunked_list::ChunkedListBytes<char, 4096, Allocator>;
+
+  static_assert(chunk_bytes<long, BudgetList::chunk_size, Allocator>() <= budget);
+  static_assert(chunk_bytes<long, BudgetList::chunk_size + 1, Allocator>() > budget);
+  static_assert(chunk_bytes<char, CharList::chunk_size, Allocator>() <= 4096);
+  static_assert(chunk_bytes<char, CharList::chunk_size + 1, Allocator>() > 4096);
+  static_assert(CharList::chunk_size > 4000);
+  static_assert(chunked_list::utility::chunk_size_for_bytes<long, sizeof(long), Allocator>() == 0);
+
+  BudgetList list;
+
+  for (long i = 0; i < 100; ++i) {
+    list.push_back(i);
+  }
+
+  ASSERT(list.size() == 100)
+  ASSERT(list[99] == 99)
+  using BudgetChunkIterator = typename BudgetList::chunk_iterator;
+
+  ASSERT(static_cast<size_t>(std::distance(list.template begin<BudgetChunkIterator>(),
+                                           list.template end<BudgetChunkIterator>())) ==
+         (100 + BudgetList::chunk_size - 1) / BudgetList::chunk_size)
+}
+
+SUBTEST(Page_Allocation) {
+  auto assertPacked = []<template<typename> typename PageAllocator>() {
+    using PageList = CurrentList<long, ChunkSize, PageAllocator>;
+    using PageChunkIterator = typename PageList::chunk_iterator;
+    using ChunkAllocator = typename PageList::template allocator_type<typename PageList::Chunk>;
+
+    chunked_list::PageArena &arena = ChunkAllocator::arena();
+
+    {
+      PageList list;
+
+      for (long i = 0; i < 256; ++i) {
+        list.push_back(i);
+      }
+
+      ASSERT(arena.mapped_size() >= chunked_list::PageArena::huge_page_size)
+
+      // Chunks pushed into a new arena are carved out of the same region one after another
+      const std::byte *previous = nullptr;
+
+      for (auto it = list.template begin<PageChunkIterator>(); it != list.template end<PageChunkIterator>(); ++it) {
+        const auto *address = reinterpret_cast<const std::byte *>(&*it);
+        ASSERT(!previous || address == previous + arena.block_size())
+        previous = address;
+      }
+
+      list.template sort<std::greater<long>>();
+      ASSERT(list[0] == 255 && list[255] == 0)
+
+      for (size_t i = 0; i < 128; ++i) {
+        list.erase(list.begin());
+      }
+
+      ASSERT(list.size() == 128 && list[0] == 127)
+    }
+
+    const size_t mapped = arena.mapped_size();
+
+    {
+      PageList list;
+
+      for (long i = 0; i < 256; ++i) {
+        list.push_back(i);
+      }
+
+      ASSERT(arena.mapped_size() == mapped)
+    }
+  };
+
+  assertPacked.template operator()<chunked_list::PageAllocator>();
+  assertPacked.template operator()<chunked_list::HugePageAllocator>();
+}
+
+SUBTEST(Allocator_Awareness) {
+  List list{BASIC_INITIALIZER_LIST};
+
+  List copied{list};
+  ASSERT(copied == list)
+
+  List assigned;
+  assigned = copied;
+  ASSERT(assigned == list)
+
+  List swapped;
+  swap(swapped, assigned);
+  ASSERT(swapped == list && assigned.empty())
+
+  class CountingResource final : public std::pmr::memory_resource {
+      void *do_allocate(const size_t bytes, const size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+      }
+
+      void do_deallocate(void *ptr, const size_t bytes, const size_t alignment) override {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+      }
+
+      bool do_is_equal(const memory_resource &other) const noexcept override { return this == &other; }
+
+    public:
+      size_t allocations{0};
+      size_t deallocations{0};
+  };
+
+  using StringList = chunked_list::pmr::ChunkedList<std::pmr::string, ChunkSize>;
+
+  CountingResource first;
+  CountingResource second;
+
+  auto allocatedFrom = [](const StringList &strings, const CountingResource &resource) {
+    return std::all_of(strings.begin(), strings.end(), [&resource](const std::pmr::string &string) {
+      return string.get_allocator().resource() == &resource;
+    });
+  };
+
+  {
+    StringList strings{&first};
+
+    for (size_t i = 0; i < 20; ++i) {
+      strings.emplace_back(std::string(32, static_cast<char>('a' + i)));
+    }
+
+    ASSERT(strings.get_allocator().resource() == &first)
+    ASSERT(allocatedFrom(strings, first))
+    ASSERT(first.allocations == 20 + (20 + ChunkSize - 1) / ChunkSize)
+
+    StringList copy{strings, &second};
+    ASSERT(allocatedFrom(copy, second) && copy[19] == strings[19])
+
+    // Polymorphic allocators don't propagate, so moving between resources moves each element instead
+    StringList moved{&second};
+    moved = std::move(strings);
+    ASSERT(strings.empty() && moved.size() == 20 && allocatedFrom(moved, second))
+
+    StringList taken{std::move(moved), &second};
+    ASSERT(moved.empty() && taken.size() == 20 && allocatedFrom(taken, second))
+
+    // A chunk must be freed through the resource which allocated it, so splicing between resources moves each element
+    StringList spliced{&first};
+    spliced.splice(taken);
+    ASSERT(taken.empty() && spliced.size() == 20 && allocatedFrom(spliced, first) && spliced[19] == copy[19])
+  }
+
+  ASSERT(first.allocations == first.deallocations)
+  ASSERT(second.allocations == second.deallocations)
+
+  std::byte buffer[1 << 14];
+  std::pmr::monotonic_buffer_resource arena{buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+
+  chunked_list::pmr::ChunkedList<long, ChunkSize> longs{&arena};
+
+  for (long i = 0; i < 64; ++i) {
+    longs.push_back(i);
+  }
+
+  ASSERT(longs.size() == 64 && longs[63] == 63)
+}
+
+SUBTEST(Pooled_Allocation) {
+  using PoolList = CurrentList<long, ChunkSize, chunked_list::PoolAllocator>;
+  using Pool = typename chunked_list::PoolAllocator<typename PoolList::Chunk>::pool_type;
+
+  constexpr long count = 8 * ChunkSize;
+
+  auto fill = [](PoolList &list) {
+    for (long i = 0; i < count; ++i) {
+      list.push_back(i);
+    }
+  };
+
+  const size_t initial = Pool::cached();
+
+  {
+    PoolList list;
+    fill(list);
+  }
+
+  const size_t cached = Pool::cached();
+  ASSERT(cached >= 8 && cached >= initial)
+
+  {
+    // Chunks freed by the previous list are popped from the free list of the thread
+    PoolList list;
+    fill(list);
+
+    ASSERT(Pool::cached() == cached - 8)
+    ASSERT(list.size() == static_cast<size_t>(count) && list[count - 1] == count - 1)
+  }
+
+  ASSERT(Pool::cached() == cached)
+
+  // Chunks allocated on another thread are cached by the thread which frees them
+  PoolList moved;
+
+  std::thread{[&moved, &fill] {
+    PoolList list;
+    fill(list);
+    moved = std::move(list);
+  }}.join();
+
+  ASSERT(moved.size() == static_cast<size_t>(count))
+  moved.clear();
+  ASSERT(Pool::cached() == std::min(cached + 8, Pool::local_capacity))
+}
+
+SUBTEST(Ranges) {
+  using RangeList = CurrentList<long, ChunkSize, Allocator>;
+  using Slice = typename RangeList::mutable_slice;
+  using ChunkSpans = decltype(std::declval<RangeList &>() | chunked_list::views::chunks);
+
+  static_assert(std::ranges::bidirectional_range<RangeList>);
+  static_assert(std::ranges::sized_range<RangeList>);
+  static_assert(std::ranges::bidirectional_range<const RangeList>);
+  static_assert(std::ranges::view<Slice>);
+  static_assert(std::ranges::sized_range<Slice>);
+  static_assert(std::ranges::borrowed_range<Slice>);
+  static_assert(std::ranges::view<ChunkSpans>);
+  static_assert(std::ranges::bidirectional_range<ChunkSpans>);
+  static_assert(std::is_same_v<typename std::iterator_traits<std::ranges::iterator_t<ChunkSpans>>::iterator_category,
+                               std::input_iterator_tag>);
+
+  RangeList list;
+
+  for (long i = 0; i < 50; ++i) {
+    list.push_back(i);
+  }
+
+  auto squares = list | std::views::filter([](const long value) { return value % 2 == 1; }) |
+                 std::views::transform([](const long value) { return value * value; }) | std::views::take(3);
+  std::vector<long> expected{1, 9, 25};
+  ASSERT(std::ranges::equal(squares, expected))
+
+  Slice slice = list.slice(3, 42);
+  ASSERT(slice.size() == 39 && std::ranges::size(slice) == 39)
+
+  long sum = 0;
+  size_t spans = 0;
+
+  for (const std::span<long> span : slice | chunked_list::views::chunks) {
+    ASSERT(!span.empty() && span.size() <= ChunkSize)
+    ++spans;
+
+    for (const long value : span) {
+      sum += value;
+    }
+  }
+
+  ASSERT(sum == (3 + 41) * 39 / 2)
+  ASSERT(spans == (41 / ChunkSize) - (3 / ChunkSize) + 1)
+
+  for (long &value : list | chunked_list::views::chunks | std::views::join) {
+    value = -value;
+  }
+
+  ASSERT(list[0] == 0 && list[49] == -49)
+  ASSERT(std::ranges::distance(list.slice(7, 7) | chunked_list::views::chunks) == 0)
+}
+
+SUBTEST(Structure_Of_Arrays) {
+  using Records = chunked_list::BasicChunkedSoA<ChunkSize, Allocator, long, double, std::string>;
+
+  static_assert(std::ranges::bidirectional_range<Records>);
+
+  Records records;
+
+  for (long i = 0; i < 50; ++i) {
+    records.emplace_back(i, static_cast<double>(i) / 2, std::to_string(i));
+  }
+
+  ASSERT(records.size() == 50)
+  ASSERT(records.template get<2>(37) == "37")
+
+  auto [id, weight, name] = records[21];
+  ASSERT(id == 21 && weight == 10.5 && name == "21")
+
+  // Proxy references write through to the field arrays
+  id = -21;
+  records[22] = typename Records::value_type{-22, 0.0, "-22"};
+  ASSERT(records.template get<0>(21) == -21 && records.template get<2>(22) == "-22")
+
+  long total = 0;
+  size_t spans = 0;
+
+  records.template for_each_span<0>([&total, &spans](const std::span<long> ids) {
+    ASSERT(ids.size() <= ChunkSize)
+    ++spans;
+
+    for (const long value : ids) {
+      total += value;
+    }
+  });
+
+  ASSERT(spans == (50 + ChunkSize - 1) / ChunkSize)
+  ASSERT(total == 49 * 50 / 2 - 2 * (21 + 22))
+
+  Records copy = records;
+  long expected = 49;
+
+  for (auto it = copy.end(); it != copy.begin(); --expected) {
+    --it;
+    ASSERT(it.template get<0>() == (expected == 21 || expected == 22 ? -expected : expected))
+  }
+
+  while (copy.size() > 1) {
+    copy.pop_back();
+  }
+
+  Records moved = std::move(copy);
+  ASSERT(copy.empty() && moved.size() == 1 && std::get<2>(moved[0]) == "0")
+}
+
+SUBTEST(Compressed_Chunks) {
+  using Series = chunked_list::CompressedChunkedList<long, ChunkSize, Allocator>;
+  static_assert(chunked_list::utility::integer<long> && !chunked_list::utility::integer<bool>);
+
+  Series series;
+  std::vector<long> expected;
+  long timestamp = 1'700'000'000;
+
+  for (long i = 0; i < 200; ++i) {
+    timestamp += i % 7;
+    series.push_back(timestamp);
+    expected.push_back(timestamp);
+  }
+
+  series.push_back(-5);
+  expected.push_back(-5);
+
+  const size_t uncompressed = series.memory_usage().reserved_bytes;
+  series.freeze();
+
+  ASSERT(series.size() == expected.size())
+  ASSERT(series.frozen_chunks() == (expected.size() - 1) / ChunkSize)
+
+  if constexpr (ChunkSize >= 8) {
+    ASSERT(series.memory_usage().reserved_bytes < uncompressed)
+  }
+
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT(series[i] == expected[i])
+  }
+
+  std::vector<long> scanned;
+
+  series.for_each_segment([&scanned](const long *segment, const size_t count) {
+    scanned.insert(scanned.end(), segment, segment + count);
+  });
+
+  ASSERT(scanned == expected)
+
+  // Popping past the uncompressed elements thaws the last frozen block
+  for (size_t i = 0; i < ChunkSize + 1; ++i) {
+    series.pop_back();
+    expected.pop_back();
+  }
+
+  ASSERT(series.size() == expected.size() && series[expected.size() - 1] == expected.back())
+
+  series.thaw();
+  ASSERT(series.frozen_chunks() == 0 && series.size() == expected.size())
+
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT(series[i] == expected[i])
+  }
+}
+
+SUBTEST(Copy_On_Write) {
+  using CowList = chunked_list::CowChunkedList<long, ChunkSize, Allocator>;
+
+  static_assert(std::random_access_iterator<typename CowList::iterator>);
+
+  CowList list;
+
+  for (long i = 0; i < 40; ++i) {
+    list.push_back(i);
+  }
+
+  const size_t chunks = (40 + ChunkSize - 1) / ChunkSize;
+  CowList snapshot = list.snapshot();
+  ASSERT(snapshot.shared_chunks() == chunks && snapshot == list)
+
+  // Writing through an index clones only the chunk holding the element
+  list[13] = -13;
+  ASSERT(list.shared_chunks() == chunks - 1)
+  ASSERT(snapshot[13] == 13 && list[13] == -13)
+
+  list.pop_back();
+  list.push_back(100);
+  ASSERT(snapshot[39] == 39 && list[39] == 100)
+
+  for (long &value : list) {
+    value *= 2;
+  }
+
+  ASSERT(list.shared_chunks() == 0 && snapshot.shared_chunks() == 0)
+
+  for (long i = 0; i < 40; ++i) {
+    ASSERT(snapshot[static_cast<size_t>(i)] == i)
+  }
+
+  // A snapshot handed to another thread is unaffected by the writer
+  long total = 0;
+  CowList reading = list.snapshot();
+
+  std::thread reader{[&total, reading = std::move(reading)] {
+    for (const long value : reading) {
+      total += value;
+    }
+  }};
+
+  list[0] = 1'000;
+  list.clear();
+  reader.join();
+
+  ASSERT(total == 2 * (39 * 40 / 2 - 13 - 13 - 39 + 100))
+
+  // References taken before a snapshot can't write into it, as the chunks they refer to are cloned rather than shared
+  CowList fresh{1, 2, 3};
+  long &first = fresh[0];
+  const CowList before = fresh.snapshot();
+  first = 42;
+  ASSERT(before[0] == 1 && fresh[0] == 42 && before.shared_chunks() == (3 + ChunkSize - 1) / ChunkSize - 1)
+
+  long &emplaced = fresh.emplace_back(4);
+  const CowList after = fresh.snapshot();
+  emplaced = 40;
+  ASSERT(after[3] == 4 && fresh[3] == 40)
+}
+
+SUBTEST(Parallel_Construction) {
+  using List = chunked_list::ChunkedList<Block, ChunkSize, Allocator>;
+
+  // Large enough to be constructed on several threads
+  const size_t count = chunked_list::utility::parallel_threshold / sizeof(Block) + 3;
+
+  const List filled(count, Block{7});
+  ASSERT(filled.size() == count)
+  ASSERT(std::all_of(filled.begin(), filled.end(), [](const Block &block) { return block == Block{7}; }))
+
+  List generated(count, [](const size_t index) { return Block{static_cast<long>(index) * 2}; });
+  ASSERT(generated.size() == count)
+
+  for (size_t i = 0; i < count; i += 97) {
+    ASSERT(generated[i].front() == static_cast<long>(i) * 2)
+  }
+
+  ASSERT(generated[count - 1].front() == static_cast<long>(count - 1) * 2)
+
+  const List copy = generated;
+  ASSERT(copy.size() == count && copy == generated)
+
+  generated.fill(Block{-1});
+  ASSERT(std::all_of(generated.begin(), generated.end(), [](const Block &block) { return block == Block{-1}; }))
+  ASSERT(copy[count - 1].front() == static_cast<long>(count - 1) * 2)
+
+  generated.assign(5, Block{3});
+  ASSERT(generated.size() == 5 && generated == List(5, Block{3}))
+
+  // Small lists, and large ones which were not opted in, are constructed on the calling thread
+  const List small(3, [](const size_t index) { return Block{static_cast<long>(index) + 1}; });
+  ASSERT(small == (List{Block{1}, Block{2}, Block{3}}))
+
+  using Sequential = chunked_list::ChunkedList<std::array<int, 64>, ChunkSize, Allocator>;
+
+  Sequential sequential(count, [](const size_t index) { return std::array<int, 64>{static_cast<int>(index)}; });
+  sequential.fill({4});
+  ASSERT(sequential.size() == count && sequential[count - 1].front() == 4 && sequential == Sequential(count, {4}))
+
+  const List none(0, Block{1});
+  ASSERT(none.empty())
+}
+
+SUBTEST(Sorted_Search) {
+  using List = chunked_list::ChunkedList<long, ChunkSize, Allocator>;
+
+  List list;
+
+  // Every even number below 200 twice, in reverse, so sorting reorders every chunk
+  for (long i = 198; i >= 0; i -= 2) {
+    list.push_back(i);
+    list.push_back(i);
+  }
+
+  list.template sort<std::less<long>, chunked_list::utility::InsertionSort>();
+
+  auto checkSearches = [&list] {
+    for (long value = -1; value <= 200; ++value) {
+      const auto lower = list.lower_bound(value);
+      const auto upper = list.upper_bound(value);
+      const long expectedLower = std::clamp((value + 1) / 2 * 2, 0L, 200L);
+
+      ASSERT(std::distance(list.cbegin(), lower) == expectedLower)
+      ASSERT(std::distance(lower, upper) == (value >= 0 && value < 200 && value % 2 == 0 ? 2 : 0))
+      ASSERT(list.contains_sorted(value) == (lower != upper))
+
+      const auto [first, last] = list.equal_range(value);
+      ASSERT(first == lower && last == upper)
+    }
+  };
+
+  checkSearches();
+
+  // Changing the list drops its fences, so searches walk the chunks until they are built again
+  list.push_back(500);
+  ASSERT(list.contains_sorted(500) && !list.contains_sorted(499))
+  list.pop_back();
+  checkSearches();
+
+  list.build_fences();
+  checkSearches();
+
+  // Searching by the comparison the list is sorted by
+  list.template sort<std::greater<long>>();
+  ASSERT(list.template lower_bound<std::greater<long>>(150) == list.cbegin() + 48)
+  ASSERT(list.template contains_sorted<std::greater<long>>(0) && !list.template contains_sorted<std::greater<long>>(3))
+
+  const List empty;
+  ASSERT(empty.lower_bound(0) == empty.cend() && !empty.contains_sorted(0))
+
+  // Writing through a mutable reference drops the fences, so searches see the written element
+  List evens;
+
+  for (long i = 0; i < 32; i += 2) {
+    evens.push_back(i);
+  }
+
+  evens.sort();
+  evens[4] = 9;
+  ASSERT(evens.lower_bound(9) == evens.cbegin() + 4 && evens.contains_sorted(9) && !evens.contains_sorted(8))
+
+  evens.build_fences();
+  *(evens.begin() + 5) = 11;
+  ASSERT(evens.lower_bound(11) == evens.cbegin() + 5 && evens.contains_sorted(11))
+
+  // Lists which aren't opted into fences search by walking their chunks
+  using Unfenced = chunked_list::ChunkedList<int, ChunkSize, Allocator>;
+
+  Unfenced ints;
+
+  for (int i = 0; i < 32; i += 2) {
+    ints.push_back(i);
+  }
+
+  ints.sort();
+  ASSERT(ints.lower_bound(9) == ints.cbegin() + 5 && ints.contains_sorted(10) && !ints.contains_sorted(9))
+}
+
+SUBTEST(Zone_Maps) {
+  using Series = chunked_list::ChunkedList<double, ChunkSize, Allocator>;
+
+  Series series;
+
+  for (int i = 0; i < 100; ++i) {
+    series.push_back(i);
+  }
+
+  ASSERT(series.count_between(10, 19.5) == 10)
+  ASSERT(*series.find_between(42.5, 50) == 43)
+  ASSERT(series.find_between(200, 300) == series.cend())
+
+  double total = 0;
+  series.for_each_between(90, 1'000, [&total](const double value) { total += value; });
+  ASSERT(total == 945)
+
+  // Writing through a reference ends the zone map of the chunk, so the chunk is scanned until it is rebuilt
+  series[5] = 500;
+  ASSERT(series.count_between(400, 600) == 1)
+
+  series.rebuild_zone_maps();
+  ASSERT(series.count_between(400, 600) == 1 && *series.find_between(400, 600) == 500)
+
+  series.pop_back();
+  ASSERT(series.count_between(99, 99) == 0 && series.count_between(0, 1'000) == 99)
+
+  // Reading elements into the chunks rebuilds their zone maps, including that of the partly filled back chunk
+  int pipeFds[2];
+  ASSERT(pipe(pipeFds) == 0)
+
+  double values[20];
+  std::iota(std::begin(values), std::end(values), 100.0);
+  ASSERT(write(pipeFds[1], values, sizeof(values)) == static_cast<ssize_t>(sizeof(values)))
+  close(pipeFds[1]);
+
+  Series read{0.5};
+  while (read.read_segments(pipeFds[0], 20) != 0) {}
+  close(pipeFds[0]);
+
+  ASSERT(read.size() == 21 && read.count_between(100, 200) == 20 && read.count_between(0, 50) == 1)
+  ASSERT(read.count_between(105, 110.5) == 6 && *read.find_between(100, 100) == 100)
+
+  // Lists without zone maps scan every chunk
+  const chunked_list::ChunkedList<long, ChunkSize, Allocator> plain{3, 1, 2};
+  ASSERT(plain.count_between(2, 3) == 2 && *plain.find_between(1, 1) == 1)
+}
+
+SUBTEST(Equality_And_Hashing) {
+  using List = chunked_list::ChunkedList<int, ChunkSize, Allocator>;
+
+  List contiguous;
+
+  for (int i = 0; i < 50; ++i) {
+    contiguous.push_back(i);
+  }
+
+  // Splicing keeps the partially filled back chunk of the front list, so the elements are split between chunks
+  // differently than in the contiguous list
+  List spliced{0, 1, 2};
+  List rest;
+
+  for (int i = 3; i < 50; ++i) {
+    rest.push_back(i);
+  }
+
+  spliced.splice(rest);
+
+  const std::hash<List> hasher;
+
+  ASSERT(contiguous == spliced && !(contiguous != spliced))
+  ASSERT(hasher(contiguous) == hasher(spliced))
+
+  spliced[49] = -1;
+  ASSERT(contiguous != spliced && hasher(contiguous) != hasher(spliced))
+
+  spliced.pop_back();
+  ASSERT(contiguous != spliced && List{} == List{} && hasher(List{}) == hasher(List{}))
+
+  // Large enough to be compared on several threads
+  using Blocks = chunked_list::ChunkedList<Block, ChunkSize, Allocator>;
+
+  const size_t count = chunked_list::utility::parallel_threshold / sizeof(Block) + 3;
+
+  Blocks large(count, Block{7});
+  Blocks largeCopy{large};
+
+  ASSERT(large == largeCopy)
+
+  largeCopy[count - 2][31] = 8;
+  ASSERT(large != largeCopy)
+
+  largeCopy[count - 2][31] = 0;
+  largeCopy[0][0] = 8;
+  ASSERT(large != largeCopy)
+
+  // As large a list which was not opted in is compared on the calling thread
+  using Rows = chunked_list::ChunkedList<std::array<int, 64>, ChunkSize, Allocator>;
+
+  const Rows rows(count, {7});
+  Rows otherRows{rows};
+  ASSERT(rows == otherRows)
+
+  otherRows[count - 1][63] = 1;
+  ASSERT(rows != otherRows)
+
+  using Strings = chunked_list::ChunkedList<std::string, ChunkSize, Allocator>;
+
+  const Strings words{"chunk", "by", "chunk"};
+  Strings otherWords{"chunk"};
+  otherWords.splice(Strings{"by", "chunk"});
+
+  ASSERT(words == otherWords && std::hash<Strings>{}(words) == std::hash<Strings>{}(otherWords))
+  ASSERT((words != Strings{"chunk", "by", "byte"}))
+}
+
+SUBTEST(Bulk_Resizing) {
+  using List = chunked_list::ChunkedList<int, ChunkSize, Allocator>;
+
+  List list;
+  list.resize(37, 5);
+  ASSERT(list.size() == 37 && list.memory_usage().chunks == (37 + ChunkSize - 1) / ChunkSize && list[36] == 5)
+
+  list.resize(40);
+  ASSERT(list.size() == 40 && list[36] == 5 && list[37] == 0 && list[39] == 0)
+
+  for (size_t i = 0; i < list.size(); ++i) {
+    list[i] = static_cast<int>(i);
+  }
+
+  list.truncate(50);
+  ASSERT(list.size() == 40)
+
+  list.truncate(21);
+  ASSERT(list.size() == 21 && list.memory_usage().chunks == (21 + ChunkSize - 1) / ChunkSize && list[20] == 20)
+
+  list.pop_back(4);
+  ASSERT(list.size() == 17 && list[16] == 16)
+
+  list.push_back(17);
+  ASSERT(list.size() == 18 && list[17] == 17)
+
+  list.resize(0);
+  ASSERT(list.empty() && list.memory_usage().chunks == 0)
+
+  using Strings = chunked_list::ChunkedList<std::string, ChunkSize, Allocator>;
+
+  Strings strings{"a", "b", "c"};
+  const size_t count = chunked_list::utility::parallel_threshold / sizeof(std::string) + 1;
+
+  strings.resize(count, "filler");
+  ASSERT(strings.size() == count && strings[2] == "c" && strings[3] == "filler")
+
+  strings.pop_back(strings.size() - 1);
+  ASSERT(strings.size() == 1 && strings[0] == "a")
+
+  strings.assign(3, "x");
+  ASSERT((strings == Strings{"x", "x", "x"}))
+}
+
+SUBTEST(Inline_Capacity) {
+  using SmallList = chunked_list::SmallChunkedList<std::string, 4, ChunkSize, Allocator>;
+
+  static_assert(std::bidirectional_iterator<typename SmallList::iterator>);
+
+  SmallList list{"a", "b", "c"};
+  ASSERT(list.size() == 3 && !list.spilled() && list[2] == "c")
+
+  list.push_back("d");
+  ASSERT(!list.spilled())
+
+  for (const char *value : {"e", "f", "g"}) {
+    list.emplace_back(value);
+  }
+
+  ASSERT(list.spilled() && list.size() == 7 && list[3] == "d" && list[6] == "g")
+
+  std::string joined;
+
+  for (const std::string &value : list) {
+    joined += value;
+  }
+
+  ASSERT(joined == "abcdefg")
+
+  std::string reversed;
+
+  for (auto it = list.end(); it != list.begin();) {
+    reversed += *--it;
+  }
+
+  ASSERT(reversed == "gfedcba")
+
+  size_t segments = 0;
+  list.for_each_segment([&segments](const std::string *, size_t) { ++segments; });
+  ASSERT(segments == 1 + (3 + ChunkSize - 1) / ChunkSize)
+
+  SmallList copy{list};
+  SmallList moved{std::move(list)};
+  ASSERT(copy == moved && list.empty() && !list.spilled())
+
+  for (int i = 0; i < 4; ++i) {
+    moved.pop_back();
+  }
+
+  ASSERT(!moved.spilled() && moved.size() == 3 && moved[2] == "c")
+
+  list = copy;
+  list.clear();
+  ASSERT(list.empty() && copy.size() == 7)
+}
+
+SUBTEST(Geometric_Growth) {
+  using GrowingList = chunked_list::GeometricChunkedList<long, ChunkSize, ChunkSize * 8, Allocator>;
+
+  static_assert(std::random_access_iterator<typename GrowingList::iterator>);
+
+  GrowingList list;
+  ASSERT(list.memory_usage().chunks == 0)
+
+  // The chunks hold ChunkSize, 2 * ChunkSize and 4 * ChunkSize elements, and then 8 * ChunkSize each
+  const size_t count = ChunkSize * 7 + ChunkSize * 8 * 2 + 1;
+
+  for (size_t i = 0; i < count; ++i) {
+    list.push_back(static_cast<long>(i));
+  }
+
+  ASSERT(list.size() == count && list.memory_usage().chunks == 6)
+  ASSERT(list.capacity() == ChunkSize * 7 + ChunkSize * 8 * 3)
+  ASSERT(GrowingList::chunk_capacity(2) == ChunkSize * 4 && GrowingList::chunk_capacity(5) == ChunkSize * 8)
+
+  bool indexed = true;
+
+  for (size_t i = 0; i < count; ++i) {
+    indexed = indexed && list[i] == static_cast<long>(i);
+  }
+
+  ASSERT(indexed && *(list.begin() + ChunkSize * 3) == static_cast<long>(ChunkSize * 3))
+
+  size_t segments = 0;
+  long total = 0;
+
+  list.for_each_segment([&](const long *data, const size_t size) {
+    ++segments;
+    total = std::accumulate(data, data + size, total);
+  });
+
+  ASSERT(segments == 6 && total == static_cast<long>(count * (count - 1) / 2))
+
+  // Popping the only element of the back chunk frees it
+  list.pop_back();
+  ASSERT(list.memory_usage().chunks == 5 && list[count - 2] == static_cast<long>(count - 2))
+
+  GrowingList copy{list};
+  ASSERT(copy == list)
+
+  copy[0] = -1;
+  ASSERT(!(copy == list))
+
+  GrowingList moved{1, 2};
+  moved = std::move(copy);
+  ASSERT(moved.size() == list.size() && moved[0] == -1 && copy.empty())
+
+  list.clear();
+  ASSERT(list.empty() && list.capacity() == 0 && (GrowingList{1, 2, 3}[2] == 3))
+
+  // Past the cap every chunk holds MaxChunkSize elements, so the number of chunks grows with the size
+  using CappedList = chunked_list::GeometricChunkedList<long, ChunkSize, ChunkSize, Allocator>;
+
+  CappedList capped;
+  const size_t cappedCount = ChunkSize * 5'000 + 1;
+
+  for (size_t i = 0; i < cappedCount; ++i) {
+    capped.push_back(static_cast<long>(i));
+  }
+
+  ASSERT(capped.memory_usage().chunks == 5'001 && capped.capacity() == ChunkSize * 5'001)
+  ASSERT(capped[cappedCount - 1] == static_cast<long>(cappedCount - 1))
+  ASSERT(capped[ChunkSize * 2'500] == static_cast<long>(ChunkSize * 2'500))
+  ASSERT(std::accumulate(capped.begin(), capped.end(), 0L) == static_cast<long>(cappedCount * (cappedCount - 1) / 2))
+}
+
+SUBTEST(Hive_Erasure) {
+  using Hive = chunked_list::HiveChunkedList<long, ChunkSize, Allocator>;
+
+  static_assert(std::forward_iterator<typename Hive::iterator>);
+
+  Hive hive;
+  std::vector<long *> pointers;
+
+  for (long i = 0; i < 100; ++i) {
+    pointers.push_back(&*hive.insert(i));
+  }
+
+  // Erasing every odd element leaves the even ones where they were
+  for (long i = 1; i < 100; i += 2) {
+    hive.erase(hive.get_iterator(pointers[static_cast<size_t>(i)]));
+  }
+
+  bool stable = true;
+
+  for (long i = 0; i < 100; i += 2) {
+    stable = stable && *pointers[static_cast<size_t>(i)] == i;
+  }
+
+  ASSERT(stable && hive.size() == 50)
+
+  long total = 0;
+
+  for (const long value : hive) {
+    total += value;
+  }
+
+  ASSERT(total == 49 * 50)
+
+  // Erased slots are reused before another chunk is allocated, except with single slot chunks, which were freed
+  const size_t chunks = hive.memory_usage().chunks;
+
+  for (long i = 0; i < 50; ++i) {
+    hive.insert(-1);
+  }
+
+  ASSERT(hive.memory_usage().chunks == (ChunkSize == 1 ? chunks + 50 : chunks) && hive.size() == 100)
+
+  // A chunk left empty is deallocated, and erase returns the element after the erased one
+  for (auto it = hive.begin(); it != hive.end();) {
+    it = *it == -1 || *it < 50 ? hive.erase(it) : std::next(it);
+  }
+
+  ASSERT(hive.size() == 25 && hive.memory_usage().chunks < (ChunkSize == 1 ? chunks + 50 : chunks))
+
+  Hive copy{hive};
+  copy.erase(copy.begin());
+  ASSERT(copy.size() == 24 && hive.size() == 25)
+
+  hive.clear();
+  ASSERT(hive.empty() && hive.begin() == hive.end() && hive.memory_usage().chunks == 0)
+}
+
 INTEGRATION_TEST(ChunkedList)
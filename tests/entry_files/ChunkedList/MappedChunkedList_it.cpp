@@ -0,0 +1,110 @@
+#include "../../include/ChunkedListDef.hpp"
+#include "../../include/Tests.hpp"
+
+#include <sys/mman.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include "chunked_list/MappedChunkedList.hpp"
+
+#undef TEST_DEFS
+#define TEST_DEFS                                                                                                      \
+  using MappedList = chunked_list::MappedChunkedList<int, ChunkSize>;                                                  \
+  static constexpr size_t RESERVATION = size_t{1} << 26;
+
+inline std::string temporaryPath() {
+  char path[] = "/tmp/chunked_list_XXXXXX";
+  const int fd = mkstemp(path);
+  ASSERT(fd >= 0)
+  close(fd);
+  return path;
+}
+
+SUBTEST(Reopening) {
+  const std::string path = temporaryPath();
+  constexpr int COUNT = 5000;
+
+  {
+    MappedList mapped{path, chunked_list::MappedAccess::ReadWrite, RESERVATION};
+    ASSERT(mapped->empty())
+
+    for (int i = 0; i < COUNT; ++i) {
+      mapped->push_back(i);
+    }
+  }
+  {
+    MappedList mapped{path, chunked_list::MappedAccess::ReadWrite, RESERVATION};
+    ASSERT(mapped->size() == COUNT)
+
+    int expected = 0;
+    for (const int n : *mapped) {
+      ASSERT(n == expected)
+      ++expected;
+    }
+
+    for (int i = 0; i < COUNT / 2; ++i) {
+      mapped->pop_back();
+    }
+
+    mapped->push_back(-1);
+    mapped.sync();
+  }
+  {
+    MappedList mapped{path, chunked_list::MappedAccess::ReadOnly, RESERVATION};
+    ASSERT(mapped->size() == COUNT / 2 + 1)
+    ASSERT(mapped.list()[COUNT / 2] == -1)
+    ASSERT(mapped.list()[COUNT / 2 - 1] == COUNT / 2 - 1)
+  }
+
+  bool threw = false;
+
+  try {
+    chunked_list::MappedChunkedList<long, ChunkSize> wrongType{path};
+  } catch (const std::runtime_error &) {
+    threw = true;
+  }
+
+  ASSERT(threw)
+
+  std::remove(path.c_str());
+}
+
+SUBTEST(Relocation) {
+  const std::string path = temporaryPath();
+
+  {
+    MappedList mapped{path, chunked_list::MappedAccess::ReadWrite, RESERVATION};
+
+    for (int i = 0; i < 100; ++i) {
+      mapped->push_back(i);
+    }
+  }
+
+  chunked_list::MappedArena::Header header;
+  std::ifstream{path, std::ios::binary}.read(reinterpret_cast<char *>(&header), sizeof(header));
+
+  // Occupying the previous base forces the chunk pointers to be relocated
+  void *occupied = mmap(reinterpret_cast<void *>(static_cast<uintptr_t>(header.base)), RESERVATION, PROT_NONE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+  ASSERT(occupied != MAP_FAILED)
+
+  {
+    MappedList mapped{path, chunked_list::MappedAccess::ReadWrite, RESERVATION};
+    ASSERT(mapped->size() == 100)
+
+    for (int i = 0; i < 100; ++i) {
+      ASSERT(mapped.list()[i] == i)
+    }
+
+    mapped->push_back(100);
+    mapped->erase(mapped->begin());
+    ASSERT(mapped.list()[0] == 1)
+    ASSERT(mapped.list()[99] == 100)
+  }
+
+  munmap(occupied, RESERVATION);
+  std::remove(path.c_str());
+}
+
+INTEGRATION_TEST(MappedChunkedList)
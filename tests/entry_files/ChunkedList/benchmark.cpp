@@ -14,17 +14,24 @@ PERFORMANCE_BENCHMARK("ChunkedList") {
 
   AlignedArray<List> listContainer;
 
-  callPerformanceTest([&listContainer]() mutable -> void { listContainer.construct(0); }, "Constructing a list");
+  callPerformanceTest(
+    [&listContainer] {
+      listContainer.construct(0);
+      listContainer.destroy(0);
+    },
+    "Constructing and destroying a list");
+
+  constexpr int PUSHES = 1'000;
 
-  constexpr int PUSHES = 4;
+  listContainer.construct(0);
 
   callPerformanceTest(
-    [&listContainer]{
+    [&listContainer] {
       for (int i = 0; i < PUSHES; ++i) {
         listContainer.load()->push_back(i);
       }
     },
-    concatenate("Pushing ", PUSHES, " ints").c_str());
+    concatenate("Pushing ", PUSHES, " ints").c_str(), [&listContainer] { listContainer.load()->clear(); });
 
   callPerformanceTest(
     [&listContainer] {
@@ -32,7 +39,25 @@ PERFORMANCE_BENCHMARK("ChunkedList") {
         listContainer.load()->pop_back();
       }
     },
-    concatenate("Popping ", PUSHES, " ints").c_str());
+    concatenate("Popping ", PUSHES, " ints").c_str(),
+    [&listContainer] {
+      listContainer.load()->clear();
+
+      for (int i = 0; i < PUSHES; ++i) {
+        listContainer.load()->push_back(i);
+      }
+    });
+
+  listContainer.destroy(0);
+
+  constexpr int JOINED = 1'000'000;
+
+  ChunkedList<int, 64, CustomAllocator> joinedList;
+
+  for (int i = 0; i < JOINED; ++i) {
+    joinedList.push_back(i);
+  }
 
-  callPerformanceTest([&listContainer] { listContainer.destroy(0); }, "Destroying");
+  callPerformanceTest([&joinedList] { doNotOptimize(joinedList.concat()); },
+                      concatenate("Concatenating ", JOINED, " ints").c_str());
 }
@@ -0,0 +1,381 @@
+#include "benchmark_utility.hpp"
+#include "chunked_list/ChunkedList.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+  using namespace test_utility;
+  using chunked_list::ChunkedList;
+
+  constexpr uint64_t SEED = 0x5eed;
+  constexpr size_t RANDOM_ACCESSES = 1'000;
+  constexpr size_t ERASURES = 100;
+
+  // Benchmarks whose work grows with both the element count and the number of operations are skipped above these
+  // counts, as they would otherwise take minutes each
+  constexpr size_t MAX_LINEAR_ACCESS_COUNT = 1'000'000;
+  constexpr size_t MAX_SHIFTING_ERASE_COUNT = 10'000'000;
+
+  // Larger than the last level cache of most machines, so writing it evicts a container before a cold scan
+  constexpr size_t EVICTION_BYTES = size_t{64} << 20;
+
+  // Chunks and nodes are dealt among this many lists to scatter them, leaving gaps far wider than a page between
+  // neighbours
+  constexpr size_t SCATTER_BUCKETS = 256;
+
+  template<typename T>
+  struct TypeName;
+
+  template<>
+  struct TypeName<int> {
+      static constexpr const char *value = "int";
+  };
+
+  template<>
+  struct TypeName<double> {
+      static constexpr const char *value = "double";
+  };
+
+  template<>
+  struct TypeName<std::string> {
+      static constexpr const char *value = "string";
+  };
+
+  template<typename Container>
+  struct ContainerName;
+
+  template<typename T>
+  struct ContainerName<std::vector<T>> {
+      static constexpr const char *value = "std::vector";
+      static constexpr size_t chunk_size = 0;
+  };
+
+  template<typename T>
+  struct ContainerName<std::deque<T>> {
+      static constexpr const char *value = "std::deque";
+      static constexpr size_t chunk_size = 0;
+  };
+
+  template<typename T>
+  struct ContainerName<std::list<T>> {
+      static constexpr const char *value = "std::list";
+      static constexpr size_t chunk_size = 0;
+  };
+
+  template<typename T, size_t ChunkSize>
+  struct ContainerName<ChunkedList<T, ChunkSize>> {
+      static constexpr const char *value = "ChunkedList";
+      static constexpr size_t chunk_size = ChunkSize;
+  };
+
+  template<typename Container>
+  constexpr bool is_std_list = std::is_same_v<Container, std::list<typename Container::value_type>>;
+
+  template<typename Container>
+  constexpr bool is_chunked_list = ContainerName<Container>::chunk_size != 0;
+
+  template<typename T>
+  T makeValue(std::mt19937_64 &engine) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return std::to_string(engine() % 1'000'000);
+    } else if constexpr (std::is_floating_point_v<T>) {
+      return std::uniform_real_distribution<T>{-1e6, 1e6}(engine);
+    } else {
+      return static_cast<T>(engine() % 1'000'000'000);
+    }
+  }
+
+  template<typename T>
+  size_t weigh(const T &value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return value.size();
+    } else if constexpr (std::is_floating_point_v<T>) {
+      return static_cast<size_t>(value < 0 ? -value : value);
+    } else {
+      return static_cast<size_t>(value);
+    }
+  }
+
+  template<typename Container>
+  typename Container::iterator iteratorAt(Container &container, const size_t index) {
+    if constexpr (is_std_list<Container>) {
+      return std::next(container.begin(), static_cast<std::ptrdiff_t>(index));
+    } else {
+      return container.begin() + index;
+    }
+  }
+
+  template<typename Container>
+  const typename Container::value_type &elementAt(Container &container, const size_t index) {
+    if constexpr (is_std_list<Container>) {
+      return *std::next(container.begin(), static_cast<std::ptrdiff_t>(index));
+    } else {
+      return container[index];
+    }
+  }
+
+  /**
+   * @return Whether an operation which walks to a position once per call is run for a container of count elements
+   */
+  template<typename Container>
+  bool runsLinearAccess(const size_t count) {
+    if constexpr (is_std_list<Container>) {
+      return count <= MAX_LINEAR_ACCESS_COUNT;
+    } else if constexpr (is_chunked_list<Container>) {
+      return count <= MAX_LINEAR_ACCESS_COUNT * 10;
+    } else {
+      return true;
+    }
+  }
+
+  /**
+   * @brief Evicts every container from the caches by writing a buffer larger than them
+   */
+  void evictCaches() {
+    static std::vector<char> buffer(EVICTION_BYTES);
+    static char value = 0;
+
+    std::fill(buffer.begin(), buffer.end(), ++value);
+    doNotOptimize(buffer.data());
+  }
+
+  /**
+   * @brief Relinks the chunks of a chunked list, or the nodes of a std::list, in a shuffled order by dealing them
+   * among buckets at random and joining the buckets back together. Traversing it then jumps between addresses the
+   * hardware prefetcher can't predict, as in a list built up over time alongside other allocations
+   */
+  template<typename Container>
+  void scatter(Container &container, std::mt19937_64 &engine) {
+    if constexpr (is_chunked_list<Container>) {
+      using chunk_iterator = typename Container::chunk_iterator;
+      std::vector<Container> buckets(SCATTER_BUCKETS);
+
+      while (!container.empty()) {
+        const auto first = container.template begin<chunk_iterator>();
+        buckets[engine() % SCATTER_BUCKETS].splice(container.extract_chunks(first, std::next(first)));
+      }
+
+      for (Container &bucket : buckets) {
+        container.splice(bucket);
+      }
+    } else if constexpr (is_std_list<Container>) {
+      std::vector<Container> buckets(SCATTER_BUCKETS);
+
+      while (!container.empty()) {
+        Container &bucket = buckets[engine() % SCATTER_BUCKETS];
+        bucket.splice(bucket.end(), container, container.begin());
+      }
+
+      for (Container &bucket : buckets) {
+        container.splice(container.end(), bucket);
+      }
+    }
+  }
+
+  /**
+   * @brief Sums the weights of every element, through for_each_segment for chunked lists so that the chunks ahead are
+   * prefetched
+   */
+  template<typename Container>
+  size_t scan(const Container &container) {
+    using T = typename Container::value_type;
+    size_t total = 0;
+
+    if constexpr (is_chunked_list<Container>) {
+      container.for_each_segment([&total](const T *data, const size_t size) {
+        for (size_t index = 0; index < size; ++index) {
+          total += weigh(data[index]);
+        }
+      });
+    } else {
+      for (const T &value : container) {
+        total += weigh(value);
+      }
+    }
+
+    return total;
+  }
+
+  template<typename Container>
+  void sortContainer(Container &container) {
+    if constexpr (is_chunked_list<Container>) {
+      container.sort();
+    } else if constexpr (is_std_list<Container>) {
+      container.sort();
+    } else {
+      std::sort(container.begin(), container.end());
+    }
+  }
+
+  template<typename Container>
+  std::string join(Container &container) {
+    if constexpr (is_chunked_list<Container>) {
+      return container.concat();
+    } else {
+      std::ostringstream stream;
+      bool first = true;
+
+      for (const auto &value : container) {
+        stream << (first ? "" : ", ") << value;
+        first = false;
+      }
+
+      return stream.str();
+    }
+  }
+
+  /**
+   * @brief Runs every operation on one container type holding count elements, appending a result for each. Every
+   * operation which changes the container is given a freshly filled one before each run, outside the timing
+   */
+  template<typename Container>
+  void benchmarkContainer(std::vector<BenchmarkResult> &results, const size_t count, const HarnessOptions &options) {
+    using T = typename Container::value_type;
+
+    std::mt19937_64 engine{SEED};
+    std::vector<T> values(count);
+
+    for (T &value : values) {
+      value = makeValue<T>(engine);
+    }
+
+    Container container;
+
+    auto fill = [&values, &container] {
+      container = Container{};
+
+      for (const T &value : values) {
+        container.push_back(value);
+      }
+    };
+
+    auto record = [&](const char *operation, const size_t operations, const Measurement &measurement) {
+      results.push_back(BenchmarkResult{ContainerName<Container>::value, ContainerName<Container>::chunk_size,
+                                        TypeName<T>::value, operation, count, operations, measurement});
+    };
+
+    record("push_back", count, measure(
+                                 [&] {
+                                   for (const T &value : values) {
+                                     container.push_back(value);
+                                   }
+                                 },
+                                 [&container] { container = Container{}; },
+                                 options));
+
+    record("pop_back", count, measure(
+                                [&] {
+                                  for (size_t index = 0; index < count; ++index) {
+                                    container.pop_back();
+                                  }
+                                },
+                                fill, options));
+
+    record("destroy", count, measure([&container] { Container{std::move(container)}; }, fill, options));
+
+    fill();
+
+    record("iterate", count, measure(
+                               [&container] {
+                                 size_t total = 0;
+
+                                 for (const T &value : container) {
+                                   total += weigh(value);
+                                 }
+
+                                 doNotOptimize(total);
+                               },
+                               options));
+
+    {
+      // Filled in order, the chunks would lie back to back and the hardware prefetcher alone would hide their misses
+      std::mt19937_64 scatterEngine{SEED};
+      Container scattered = container;
+      scatter(scattered, scatterEngine);
+
+      record("cold_scan", count,
+             measure([&scattered] { doNotOptimize(scan(scattered)); }, evictCaches, options));
+    }
+
+    if (runsLinearAccess<Container>(count)) {
+      std::vector<size_t> indices(RANDOM_ACCESSES);
+
+      for (size_t &index : indices) {
+        index = engine() % count;
+      }
+
+      record("random_index", RANDOM_ACCESSES, measure(
+                                                [&container, &indices] {
+                                                  for (const size_t index : indices) {
+                                                    doNotOptimize(elementAt(container, index));
+                                                  }
+                                                },
+                                                options));
+    }
+
+    record("concat", count, measure([&container] { doNotOptimize(join(container)); }, options));
+
+    if (runsLinearAccess<Container>(count) && count <= MAX_SHIFTING_ERASE_COUNT) {
+      const size_t erasures = std::min(ERASURES, count);
+      std::vector<size_t> positions(erasures);
+
+      for (size_t index = 0; index < erasures; ++index) {
+        positions[index] = engine() % (count - index);
+      }
+
+      record("erase", erasures, measure(
+                                  [&container, &positions] {
+                                    for (const size_t position : positions) {
+                                      container.erase(iteratorAt(container, position));
+                                    }
+                                  },
+                                  fill, options));
+    }
+
+    record("sort", count, measure([&container] { sortContainer(container); }, fill, options));
+  }
+
+  template<typename T>
+  void benchmarkType(std::vector<BenchmarkResult> &results, const size_t count, const HarnessOptions &options) {
+    benchmarkContainer<std::vector<T>>(results, count, options);
+    benchmarkContainer<std::deque<T>>(results, count, options);
+    benchmarkContainer<std::list<T>>(results, count, options);
+    benchmarkContainer<ChunkedList<T, 16>>(results, count, options);
+    benchmarkContainer<ChunkedList<T, 64>>(results, count, options);
+    benchmarkContainer<ChunkedList<T, 256>>(results, count, options);
+  }
+} // namespace
+
+int main(const int argc, char **argv) {
+  const BenchmarkOptions options = BenchmarkOptions::parse_or_exit(argc, argv);
+
+  if (options.harness.cpu >= 0 && !pinToCpu(options.harness.cpu)) {
+    std::cerr << "Failed to pin the benchmark to CPU " << options.harness.cpu << '\n';
+  }
+
+  if (options.harness.perf && !PerfCounters{}.available()) {
+    std::cerr << "Hardware counters are unavailable, so only durations will be reported\n";
+  }
+
+  std::vector<BenchmarkResult> results;
+
+  for (size_t count = options.min_count; count <= options.max_count; count *= 10) {
+    benchmarkType<int>(results, count, options.harness);
+    benchmarkType<double>(results, count, options.harness);
+    benchmarkType<std::string>(results, count, options.harness);
+  }
+
+  if (options.output.empty()) {
+    writeResults(std::cout, results, options.format);
+  } else {
+    std::ofstream file{options.output};
+    writeResults(file, results, options.format);
+  }
+}
@@ -149,7 +149,13 @@ inline std::string &getBoundary() {
     void main();                                                                                                       \
   }                                                                                                                    \
                                                                                                                        \
-  int main() {                                                                                                         \
+  int main(const int argc, char **argv) {                                                                              \
+    test_utility::performanceOptions = test_utility::BenchmarkOptions::parse_or_exit(argc, argv).harness;              \
+                                                                                                                       \
+    if (test_utility::performanceOptions.cpu >= 0) {                                                                   \
+      test_utility::pinToCpu(test_utility::performanceOptions.cpu);                                                    \
+    }                                                                                                                  \
+                                                                                                                       \
     std::cout << "Starting " << name << " performance benchmark\n";                                                    \
                                                                                                                        \
     DISPLAY_BOUNDARY                                                                                                   \
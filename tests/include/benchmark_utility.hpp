@@ -0,0 +1,182 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "chunked_list/detail/utility.hpp"
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+#include <linux/perf_event.h>
+#define TEST_UTILITY_PERF_EVENTS 1
+#else
+#define TEST_UTILITY_PERF_EVENTS 0
+#endif
+
+namespace test_utility {
+  /**
+   * @brief Forces a value to be computed and stored, without the compiler being able to see it is unused
+   */
+  template<typename T>
+  void doNotOptimize(const T &value);
+
+  /**
+   * @brief Forces every pending write to memory to be performed before the barrier
+   */
+  inline void clobberMemory();
+
+  /**
+   * @brief Pins the calling thread to a CPU, so a benchmark isn't migrated between cores mid-measurement
+   * @return Whether the thread was pinned, which is never the case outside Linux
+   */
+  inline bool pinToCpu(int cpu);
+
+  /**
+   * @brief Hardware event counts, as the mean over each measured run
+   */
+  struct CounterValues {
+      double instructions{0.};
+      double cache_misses{0.};
+      double branch_misses{0.};
+  };
+
+  /**
+   * @class PerfCounters
+   * @brief A group of user space hardware counters opened with perf_event_open, counting instructions, cache misses
+   * and branch misses. The counters are unavailable when the kernel or platform doesn't allow opening them
+   */
+  class PerfCounters {
+      int leader{-1};
+      int cacheMisses{-1};
+      int branchMisses{-1};
+
+    public:
+      PerfCounters();
+
+      PerfCounters(const PerfCounters &) = delete;
+
+      PerfCounters &operator=(const PerfCounters &) = delete;
+
+      ~PerfCounters();
+
+      bool available() const;
+
+      /**
+       * @brief Resets the counters and starts counting
+       */
+      void start();
+
+      /**
+       * @brief Stops counting
+       * @return The events counted since start was called
+       */
+      CounterValues stop();
+  };
+
+  /**
+   * @brief How a function is measured by the harness
+   */
+  struct HarnessOptions {
+      size_t warmup{1};
+      size_t repetitions{5};
+      int cpu{-1};
+      bool perf{false};
+  };
+
+  /**
+   * @brief The statistics of repeated timed runs of a function
+   */
+  struct Measurement {
+      size_t repetitions{0};
+      double median_ns{0.};
+      double p99_ns{0.};
+      double min_ns{0.};
+      std::optional<CounterValues> counters{};
+  };
+
+  /**
+   * @return The number of nanoseconds taken by a single call of the function
+   */
+  template<typename F>
+  double measureNanoseconds(F function);
+
+  /**
+   * @brief Runs a function for the warmup runs, then times each of the repetitions and reads the hardware counters
+   * around them when requested and available
+   * @param function The function which is measured
+   * @param setup Called before every run, without being timed, to give the function a fresh state
+   * @param options The number of warmup runs and repetitions, and whether hardware counters are read
+   */
+  template<typename F, typename Setup>
+  Measurement measure(F function, Setup setup, const HarnessOptions &options);
+
+  template<typename F>
+  Measurement measure(F function, const HarnessOptions &options);
+
+  /**
+   * @return The nearest-rank percentile of the durations, which are sorted in the process
+   */
+  inline double percentile(std::vector<double> &durations, double fraction);
+
+  /**
+   * @brief The measurement of one operation of a benchmark, on one container holding a number of elements
+   */
+  struct BenchmarkResult {
+      std::string container;
+      size_t chunk_size{0};
+      std::string type;
+      std::string operation;
+      size_t count{0};
+      size_t operations{0};
+      Measurement measurement{};
+  };
+
+  enum class OutputFormat {
+    Table,
+    Csv,
+    Json,
+  };
+
+  /**
+   * @brief The command line options shared by benchmarks
+   */
+  struct BenchmarkOptions {
+      size_t min_count{1'000};
+      size_t max_count{1'000'000};
+      OutputFormat format{OutputFormat::Table};
+      std::string output{};
+      HarnessOptions harness{};
+      bool help{false};
+
+      /**
+       * @brief Parses --min-count=N, --max-count=N, --format=table|csv|json, --output=PATH, --warmup=N,
+       * --repetitions=N and --cpu=N, whose values may also be given as the next argument, along with --perf and
+       * --help, throwing a std::invalid_argument for anything else
+       */
+      static BenchmarkOptions parse(int argc, char **argv);
+
+      /**
+       * @brief Parses the options as parse does, printing the usage and exiting successfully for --help, or printing
+       * what was wrong along with the usage and exiting with EXIT_FAILURE for an invalid option
+       */
+      static BenchmarkOptions parse_or_exit(int argc, char **argv);
+
+      /**
+       * @brief Writes the options accepted by parse, for the program at the given path
+       */
+      static void print_usage(std::ostream &os, std::string_view program);
+  };
+
+  inline void writeResults(std::ostream &os, const std::vector<BenchmarkResult> &results, OutputFormat format);
+
+  inline void writeTable(std::ostream &os, const std::vector<BenchmarkResult> &results);
+
+  inline void writeCsv(std::ostream &os, const std::vector<BenchmarkResult> &results);
+
+  inline void writeJson(std::ostream &os, const std::vector<BenchmarkResult> &results);
+} // namespace test_utility
+
+#include "detail/benchmark_utility.tpp"
@@ -0,0 +1,411 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#if TEST_UTILITY_PERF_EVENTS
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "../benchmark_utility.hpp"
+
+namespace test_utility {
+  template<typename T>
+  void doNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const void *volatile escape;
+    escape = &value;
+#endif
+  }
+
+  inline void clobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+  }
+
+  inline bool pinToCpu(const int cpu) {
+#ifdef __linux__
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+
+    return sched_setaffinity(0, sizeof(cpus), &cpus) == 0;
+#else
+    static_cast<void>(cpu);
+    return false;
+#endif
+  }
+
+#if TEST_UTILITY_PERF_EVENTS
+  namespace detail {
+    inline int openCounter(const std::uint64_t config, const int groupLeader) {
+      perf_event_attr attributes{};
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.size = sizeof(attributes);
+      attributes.config = config;
+      attributes.disabled = groupLeader < 0;
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv = 1;
+      attributes.read_format = PERF_FORMAT_GROUP;
+
+      return static_cast<int>(::syscall(SYS_perf_event_open, &attributes, 0, -1, groupLeader, 0));
+    }
+  } // namespace detail
+#endif
+
+  inline PerfCounters::PerfCounters() {
+#if TEST_UTILITY_PERF_EVENTS
+    leader = detail::openCounter(PERF_COUNT_HW_INSTRUCTIONS, -1);
+
+    if (leader < 0) {
+      return;
+    }
+
+    cacheMisses = detail::openCounter(PERF_COUNT_HW_CACHE_MISSES, leader);
+    branchMisses = detail::openCounter(PERF_COUNT_HW_BRANCH_MISSES, leader);
+
+    if (cacheMisses < 0 || branchMisses < 0) {
+      for (int *fd : {&branchMisses, &cacheMisses, &leader}) {
+        if (*fd >= 0) {
+          ::close(*fd);
+          *fd = -1;
+        }
+      }
+    }
+#endif
+  }
+
+  inline PerfCounters::~PerfCounters() {
+#if TEST_UTILITY_PERF_EVENTS
+    for (const int fd : {branchMisses, cacheMisses, leader}) {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+    }
+#endif
+  }
+
+  inline bool PerfCounters::available() const { return leader >= 0; }
+
+  inline void PerfCounters::start() {
+#if TEST_UTILITY_PERF_EVENTS
+    ::ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ::ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+  }
+
+  inline CounterValues PerfCounters::stop() {
+#if TEST_UTILITY_PERF_EVENTS
+    ::ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // With PERF_FORMAT_GROUP, the leader reads as the number of events followed by each count in opening order
+    std::uint64_t values[4]{};
+
+    if (::read(leader, values, sizeof(values)) >= static_cast<ssize_t>(sizeof(values)) && values[0] == 3) {
+      return CounterValues{static_cast<double>(values[1]), static_cast<double>(values[2]),
+                           static_cast<double>(values[3])};
+    }
+#endif
+    return CounterValues{};
+  }
+
+  template<typename F>
+  double measureNanoseconds(F function) {
+    namespace chrono = std::chrono;
+
+    const auto start = chrono::steady_clock::now();
+    function();
+    clobberMemory();
+    const auto end = chrono::steady_clock::now();
+
+    return chrono::duration<double, std::nano>{end - start}.count();
+  }
+
+  template<typename F, typename Setup>
+  Measurement measure(F function, Setup setup, const HarnessOptions &options) {
+    for (size_t run = 0; run < options.warmup; ++run) {
+      setup();
+      function();
+    }
+
+    std::optional<PerfCounters> perfCounters;
+
+    if (options.perf) {
+      perfCounters.emplace();
+
+      if (!perfCounters->available()) {
+        perfCounters.reset();
+      }
+    }
+
+    const size_t repetitions = std::max<size_t>(options.repetitions, 1);
+
+    std::vector<double> durations;
+    durations.reserve(repetitions);
+
+    CounterValues totals;
+
+    for (size_t run = 0; run < repetitions; ++run) {
+      setup();
+
+      if (perfCounters) {
+        perfCounters->start();
+      }
+
+      durations.push_back(measureNanoseconds(function));
+
+      if (perfCounters) {
+        const CounterValues counted = perfCounters->stop();
+        totals.instructions += counted.instructions;
+        totals.cache_misses += counted.cache_misses;
+        totals.branch_misses += counted.branch_misses;
+      }
+    }
+
+    Measurement measurement;
+    measurement.repetitions = repetitions;
+    measurement.median_ns = percentile(durations, 0.5);
+    measurement.p99_ns = percentile(durations, 0.99);
+    measurement.min_ns = durations.front();
+
+    if (perfCounters) {
+      const auto runs = static_cast<double>(repetitions);
+      measurement.counters =
+        CounterValues{totals.instructions / runs, totals.cache_misses / runs, totals.branch_misses / runs};
+    }
+
+    return measurement;
+  }
+
+  template<typename F>
+  Measurement measure(F function, const HarnessOptions &options) {
+    return measure(function, [] {}, options);
+  }
+
+  inline double percentile(std::vector<double> &durations, const double fraction) {
+    std::sort(durations.begin(), durations.end());
+
+    const auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(durations.size())));
+    return durations[std::clamp<size_t>(rank, 1, durations.size()) - 1];
+  }
+
+  inline BenchmarkOptions BenchmarkOptions::parse(const int argc, char **argv) {
+    using chunked_list::utility::concatenate;
+
+    BenchmarkOptions options;
+
+    for (int index = 1; index < argc; ++index) {
+      const std::string_view argument{argv[index]};
+      const size_t separator = argument.find('=');
+      const std::string_view key = argument.substr(0, separator);
+
+      if (key == "--help" || key == "-h") {
+        options.help = true;
+        continue;
+      }
+
+      if (key == "--perf") {
+        options.harness.perf = true;
+        continue;
+      }
+
+      if (key != "--min-count" && key != "--max-count" && key != "--format" && key != "--output" &&
+          key != "--warmup" && key != "--repetitions" && key != "--cpu") {
+        throw std::invalid_argument{concatenate("Unknown benchmark option ", std::string{argument}, "!")};
+      }
+
+      std::string_view value;
+
+      if (separator != std::string_view::npos) {
+        value = argument.substr(separator + 1);
+      } else if (index + 1 < argc) {
+        value = argv[++index];
+      } else {
+        throw std::invalid_argument{concatenate("Missing a value for ", std::string{key}, "!")};
+      }
+
+      // Unlike stoull, from_chars rejects trailing characters, values out of range and negative counts
+      auto number = [key, value]<typename Number>(Number &target) {
+        const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), target);
+
+        if (error != std::errc{} || end != value.data() + value.size()) {
+          throw std::invalid_argument{
+            concatenate("Expected a number for ", std::string{key}, " but received '", std::string{value}, "'!")};
+        }
+      };
+
+      if (key == "--min-count") {
+        number(options.min_count);
+      } else if (key == "--max-count") {
+        number(options.max_count);
+      } else if (key == "--warmup") {
+        number(options.harness.warmup);
+      } else if (key == "--repetitions") {
+        number(options.harness.repetitions);
+      } else if (key == "--cpu") {
+        number(options.harness.cpu);
+      } else if (key == "--output") {
+        options.output = value;
+      } else if (value == "table") {
+        options.format = OutputFormat::Table;
+      } else if (value == "csv") {
+        options.format = OutputFormat::Csv;
+      } else if (value == "json") {
+        options.format = OutputFormat::Json;
+      } else {
+        throw std::invalid_argument{concatenate("Unknown output format ", std::string{value}, "!")};
+      }
+    }
+
+    if (options.min_count == 0 || options.min_count > options.max_count) {
+      throw std::invalid_argument{"The minimum count must be positive and no greater than the maximum count!"};
+    }
+
+    return options;
+  }
+
+  inline BenchmarkOptions BenchmarkOptions::parse_or_exit(const int argc, char **argv) {
+    const std::string_view program = argc > 0 ? argv[0] : "benchmark";
+
+    try {
+      BenchmarkOptions options = parse(argc, argv);
+
+      if (options.help) {
+        print_usage(std::cout, program);
+        std::exit(EXIT_SUCCESS);
+      }
+
+      return options;
+    } catch (const std::invalid_argument &exception) {
+      std::cerr << exception.what() << "\n\n";
+      print_usage(std::cerr, program);
+      std::exit(EXIT_FAILURE);
+    }
+  }
+
+  inline void BenchmarkOptions::print_usage(std::ostream &os, const std::string_view program) {
+    os << "Usage: " << program << " [options]\n\n"
+       << "  --min-count N      The smallest number of elements benchmarked (default 1000)\n"
+       << "  --max-count N      The largest number of elements benchmarked, in powers of ten (default 1000000)\n"
+       << "  --format FORMAT    table, csv or json (default table)\n"
+       << "  --output PATH      The file the results are written to instead of the standard output\n"
+       << "  --warmup N         The untimed runs before each measurement (default 1)\n"
+       << "  --repetitions N    The timed runs of each measurement (default 5)\n"
+       << "  --cpu N            The CPU the benchmark is pinned to\n"
+       << "  --perf             Reports hardware counters along with durations\n"
+       << "  --help             Prints this message\n\n"
+       << "Values may also be given after an equals sign, as in --format=json.\n";
+  }
+
+  inline void writeResults(std::ostream &os, const std::vector<BenchmarkResult> &results, const OutputFormat format) {
+    switch (format) {
+      case OutputFormat::Table:
+        writeTable(os, results);
+        break;
+      case OutputFormat::Csv:
+        writeCsv(os, results);
+        break;
+      case OutputFormat::Json:
+        writeJson(os, results);
+        break;
+    }
+  }
+
+  inline void writeTable(std::ostream &os, const std::vector<BenchmarkResult> &results) {
+    using chunked_list::utility::concatenate;
+
+    os << std::left << std::setw(24) << "container" << std::setw(12) << "type" << std::setw(14) << "operation"
+       << std::right << std::setw(12) << "count" << std::setw(16) << "median ns/op" << std::setw(16) << "p99 ns/op"
+       << std::setw(16) << "instr/op" << std::setw(16) << "cache miss/op" << '\n';
+
+    for (const BenchmarkResult &result : results) {
+      const std::string container =
+        result.chunk_size ? concatenate(result.container, '<', result.chunk_size, '>') : result.container;
+      const auto operations = static_cast<double>(result.operations);
+      const Measurement &measurement = result.measurement;
+
+      os << std::left << std::setw(24) << container << std::setw(12) << result.type << std::setw(14)
+         << result.operation << std::right << std::setw(12) << result.count << std::fixed << std::setprecision(3)
+         << std::setw(16) << measurement.median_ns / operations << std::setw(16) << measurement.p99_ns / operations;
+
+      if (measurement.counters) {
+        os << std::setw(16) << measurement.counters->instructions / operations << std::setw(16)
+           << measurement.counters->cache_misses / operations;
+      }
+
+      os << '\n';
+    }
+
+    os << std::defaultfloat;
+  }
+
+  inline void writeCsv(std::ostream &os, const std::vector<BenchmarkResult> &results) {
+    os << "container,chunk_size,type,operation,count,operations,repetitions,median_ns,p99_ns,min_ns,median_ns_per_op,"
+          "instructions,cache_misses,branch_misses\n";
+
+    for (const BenchmarkResult &result : results) {
+      const Measurement &measurement = result.measurement;
+
+      os << result.container << ',' << result.chunk_size << ',' << result.type << ',' << result.operation << ','
+         << result.count << ',' << result.operations << ',' << measurement.repetitions << ',' << std::fixed
+         << std::setprecision(1) << measurement.median_ns << ',' << measurement.p99_ns << ',' << measurement.min_ns
+         << ',' << std::setprecision(3) << measurement.median_ns / static_cast<double>(result.operations) << ',';
+
+      if (measurement.counters) {
+        os << std::setprecision(1) << measurement.counters->instructions << ',' << measurement.counters->cache_misses
+           << ',' << measurement.counters->branch_misses;
+      } else {
+        os << ",,";
+      }
+
+      os << '\n';
+    }
+
+    os << std::defaultfloat;
+  }
+
+  inline void writeJson(std::ostream &os, const std::vector<BenchmarkResult> &results) {
+    os << "{\n  \"results\": [";
+
+    for (size_t index = 0; index < results.size(); ++index) {
+      const BenchmarkResult &result = results[index];
+      const Measurement &measurement = result.measurement;
+
+      os << (index ? ",\n" : "\n") << "    {\"container\": \"" << result.container
+         << "\", \"chunk_size\": " << result.chunk_size << ", \"type\": \"" << result.type
+         << "\", \"operation\": \"" << result.operation << "\", \"count\": " << result.count
+         << ", \"operations\": " << result.operations << ", \"repetitions\": " << measurement.repetitions
+         << std::fixed << std::setprecision(1) << ", \"median_ns\": " << measurement.median_ns
+         << ", \"p99_ns\": " << measurement.p99_ns << ", \"min_ns\": " << measurement.min_ns
+         << ", \"median_ns_per_op\": " << std::setprecision(3)
+         << measurement.median_ns / static_cast<double>(result.operations) << ", \"counters\": ";
+
+      if (measurement.counters) {
+        os << std::setprecision(1) << "{\"instructions\": " << measurement.counters->instructions
+           << ", \"cache_misses\": " << measurement.counters->cache_misses
+           << ", \"branch_misses\": " << measurement.counters->branch_misses << '}';
+      } else {
+        os << "null";
+      }
+
+      os << '}';
+    }
+
+    os << "\n  ]\n}\n" << std::defaultfloat;
+  }
+} // namespace test_utility
@@ -313,15 +313,35 @@ namespace test_utility {
     assertLeakage();
   }
 
-  template<typename F>
-  void callPerformanceTest(F function, const char *name) {
+  template<typename F, typename Setup>
+  void callPerformanceTest(F function, const char *name, Setup setup) {
+    namespace chrono = std::chrono;
+
     ++testNumber;
     std::cout << " (Test " << testNumber << ") " << name;
     std::cout.flush();
-    timeFunction(function, ": ");
+
+    const Measurement measurement = measure(function, setup, performanceOptions);
+
+    print(": median ");
+    outputDuration(chrono::duration<double, std::nano>{measurement.median_ns});
+    print(", p99 ");
+    outputDuration(chrono::duration<double, std::nano>{measurement.p99_ns});
+    print(" over ", measurement.repetitions, " runs");
+
+    if (measurement.counters) {
+      print(" (", measurement.counters->instructions, " instructions, ", measurement.counters->cache_misses,
+            " cache misses, ", measurement.counters->branch_misses, " branch misses)");
+    }
+
     std::cout << '\n' << std::endl;
   }
 
+  template<typename F>
+  void callPerformanceTest(F function, const char *name) {
+    callPerformanceTest(function, name, [] {});
+  }
+
   template<std::integral Number>
   std::string ordinalize(Number n) {
     switch (std::string &&str = std::to_string(n); str.back()) {
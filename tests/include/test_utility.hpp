@@ -1,11 +1,13 @@
 #pragma once
 
 #include <chrono>
+#include <cstring>
 #include <iostream>
 #include <new>
 #include <random>
 #include <unordered_set>
 
+#include "benchmark_utility.hpp"
 #include "chunked_list/detail/utility.hpp"
 
 namespace test_utility {
@@ -16,6 +18,11 @@ namespace test_utility {
 
   inline int testNumber{0};
 
+  /**
+   * @brief How performance tests are measured, parsed from the command line of a performance benchmark
+   */
+  inline HarnessOptions performanceOptions{};
+
   inline std::unordered_set<void *> allocatedSet{};
 
   template<typename T, bool O = false>
@@ -136,6 +143,14 @@ namespace test_utility {
   template<template<size_t> typename SubTest>
   void callSubTest();
 
+  /**
+   * @brief Measures a function with the harness, printing the median and 99th percentile of its runs, and its
+   * hardware counters when they are read
+   * @param setup Called before every run of the function, without being timed
+   */
+  template<typename F, typename Setup>
+  void callPerformanceTest(F function, const char *name, Setup setup);
+
   template<typename F>
   void callPerformanceTest(F function, const char *name);
 